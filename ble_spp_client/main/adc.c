@@ -6,10 +6,15 @@
 #include "freertos/queue.h"
 #include <string.h>
 #include <stdint.h>
-#include "nvs_flash.h"
-#include "nvs.h"
 #include "sleep.h"
+#include "display_power.h"
 #include "ble_spp_client.h"
+#include "power.h"
+#include "executor.h"
+#include "diagnostics.h"
+#include "settings.h"
+#include "throttle_map.h"
+#include "sim_hw.h"
 
 static const char *TAG = "ADC";
 static adc_oneshot_unit_handle_t adc1_handle;
@@ -23,7 +28,11 @@ static const int MAX_ERRORS = 5;
 static uint32_t adc_input_max_value = ADC_INITIAL_MAX_VALUE;
 static uint32_t adc_input_min_value = ADC_INITIAL_MIN_VALUE;
 static bool calibration_done = false;
-static esp_err_t load_calibration_from_nvs(void);
+static volatile bool sampling = false;  // latest_adc_value holds a real sample
+static volatile int32_t battery_percent = -1;
+static esp_pm_lock_handle_t pm_lock = NULL;
+static esp_err_t load_calibration(void);
+static void run_calibration(void);
 
 // Add this function prototype
 void adc_deinit(void);
@@ -37,6 +46,11 @@ esp_err_t adc_init(void)
 
     esp_err_t ret;
 
+    // Keeps the APB clock fixed for a burst so samples match the calibration
+    if (pm_lock == NULL) {
+        pm_lock = power_lock_create(ESP_PM_APB_FREQ_MAX, "adc");
+    }
+
     // Create queue first
     adc_display_queue = xQueueCreate(10, sizeof(uint32_t));
     if (adc_display_queue == NULL) {
@@ -44,6 +58,12 @@ esp_err_t adc_init(void)
         return ESP_FAIL;
     }
 
+#if SIM_HW
+    // Nothing to set up, read_channel() takes the scripted lever
+    adc_initialized = true;
+    return ESP_OK;
+#endif
+
     // ADC1 init configuration
     init_config1.unit_id = ADC_UNIT_1;
     init_config1.ulp_mode = ADC_ULP_MODE_DISABLE;
@@ -61,14 +81,19 @@ esp_err_t adc_init(void)
         ESP_LOGE(TAG, "ADC channel configuration failed");
         return ret;
     }
+    ret = adc_oneshot_config_channel(adc1_handle, BATTERY_PIN, &config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Battery ADC channel configuration failed");
+        return ret;
+    }
 
     adc_initialized = true;
     return ESP_OK;
 }
 
-int32_t adc_read_value(void)
+static int32_t read_channel(adc_channel_t channel)
 {
-    if (!adc_initialized || !adc1_handle) {
+    if (!adc_initialized || (!adc1_handle && !SIM_HW)) {
         ESP_LOGE(TAG, "ADC not properly initialized");
         return -1;
     }
@@ -78,56 +103,103 @@ int32_t adc_read_value(void)
     int32_t sum = 0;
     int valid_samples = 0;
 
+    // Back to back, a delay between samples would hold the APB lock and
+    // split the idle time between two ticks
+    power_lock_acquire(pm_lock);
     for (int i = 0; i < NUM_SAMPLES; i++) {
         int adc_raw = 0;
-        esp_err_t ret = adc_oneshot_read(adc1_handle, THROTTLE_PIN, &adc_raw);
+#if SIM_HW
+        esp_err_t ret = ESP_OK;
+        adc_raw = sim_hw_adc_read(channel);
+#else
+        esp_err_t ret = adc_oneshot_read(adc1_handle, channel, &adc_raw);
+#endif
 
         if (ret == ESP_OK) {
             sum += adc_raw;
             valid_samples++;
         }
-
-        // Small delay between samples
-        vTaskDelay(pdMS_TO_TICKS(1));
     }
+    power_lock_release(pm_lock);
 
     return valid_samples > 0 ? (sum / valid_samples) : -1;
 }
 
-static void adc_task(void *pvParameters) {
-    uint32_t last_value = 0;
+int32_t adc_read_value(void)
+{
+    return read_channel(THROTTLE_PIN);
+}
+
+static void update_battery(void)
+{
+    int32_t raw = read_channel(BATTERY_PIN);
+    if (raw < 0) {
+        return;
+    }
+
+    if (raw < BATTERY_ADC_EMPTY) {
+        raw = BATTERY_ADC_EMPTY;
+    }
+    if (raw > BATTERY_ADC_FULL) {
+        raw = BATTERY_ADC_FULL;
+    }
+    int32_t percent = (raw - BATTERY_ADC_EMPTY) * 100 / (BATTERY_ADC_FULL - BATTERY_ADC_EMPTY);
+
+    // Show the low battery once, even when riding with the display off
+    if (percent < BATTERY_ALERT_PERCENT && battery_percent >= BATTERY_ALERT_PERCENT) {
+        display_power_alert();
+    }
+    battery_percent = percent;
+}
+
+void adc_sample_throttle(void) {
+    static uint32_t last_value = 0;
     const uint32_t CHANGE_THRESHOLD = 2; // Adjust this threshold as needed
 
-    while (1) {
-        uint32_t adc_value = adc_read_value();
-        if (adc_value == -1) {
-            error_count++;
-            if (error_count >= MAX_ERRORS) {
-                ESP_LOGE(TAG, "Too many ADC errors, attempting re-initialization");
-                adc_deinit();
-                vTaskDelay(pdMS_TO_TICKS(100));
-                if (adc_init() == ESP_OK) {
-                    error_count = 0;
-                }
+    uint32_t adc_value = adc_read_value();
+    if (adc_value == -1) {
+        error_count++;
+        if (error_count >= MAX_ERRORS) {
+            // Retried on the next sample, a worker must not sit in a delay
+            ESP_LOGE(TAG, "Too many ADC errors, attempting re-initialization");
+            adc_deinit();
+            if (adc_init() == ESP_OK) {
+                error_count = 0;
             }
-            vTaskDelay(pdMS_TO_TICKS(100));  // Wait before retry
-            continue;
         }
-        error_count = 0;  // Reset error count on successful read
-
-        uint8_t mapped_value = map_adc_value(adc_value);
-        latest_adc_value = mapped_value;
+        return;
+    }
+    error_count = 0;  // Reset error count on successful read
+    diagnostics_count(DIAG_ADC_SAMPLES);
+
+    uint8_t mapped_value = map_adc_value(adc_value);
+    latest_adc_value = mapped_value;
+    sampling = true;
+    if (abs((int32_t)mapped_value - (int32_t)last_value) > CHANGE_THRESHOLD) {
+        // Throttle movement always wakes the display
+        display_power_activity();
         if(!is_connect){
-            // Only monitor value changes and reset timer when BLE is not connected
-            if (abs((int32_t)mapped_value - (int32_t)last_value) > CHANGE_THRESHOLD) {
-                sleep_reset_inactivity_timer();
-                last_value = mapped_value;
-            }
+            // Only reset the sleep timer when BLE is not connected
+            sleep_reset_inactivity_timer();
         }
+        last_value = mapped_value;
+    }
 
-        xQueueSend(adc_display_queue, &mapped_value, 0);
-        vTaskDelay(pdMS_TO_TICKS(ADC_SAMPLING_TICKS));
+    xQueueSend(adc_display_queue, &mapped_value, 0);
+}
+
+// Run every ADC_SAMPLING_MS on the control worker
+static void adc_sample(void *arg) {
+    static uint32_t battery_countdown = 0;
+
+    // The battery changes slowly, sample it at a fraction of the throttle rate
+    if (battery_countdown == 0) {
+        update_battery();
+        battery_countdown = BATTERY_SAMPLE_INTERVAL;
     }
+    battery_countdown--;
+
+    adc_sample_throttle();
 }
 
 void adc_start_task(void) {
@@ -142,22 +214,13 @@ void adc_start_task(void) {
 
 #if CALIBRATE_ADC
     ESP_LOGI(TAG, "Force calibration flag set, performing calibration");
-    // Clear existing calibration
-    nvs_handle_t nvs_handle;
-    if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle) == ESP_OK) {
-        nvs_erase_key(nvs_handle, NVS_KEY_CALIBRATED);
-        nvs_commit(nvs_handle);
-        nvs_close(nvs_handle);
-    }
-    adc_calibrate();
+    run_calibration();
 #else
     // Only calibrate if no valid calibration exists
-    if (load_calibration_from_nvs() != ESP_OK) {
-        adc_calibrate();
-    }
+    adc_calibrate();
 #endif
 
-    xTaskCreate(adc_task, "adc_task", 4096, NULL, 6, NULL);
+    ESP_ERROR_CHECK(executor_every(EXECUTOR_CONTROL, ADC_SAMPLING_MS, adc_sample, NULL));
 }
 
 
@@ -166,6 +229,10 @@ uint32_t adc_get_latest_value(void) {
     return latest_adc_value;
 }
 
+int32_t adc_get_battery_percent(void) {
+    return battery_percent;
+}
+
 void adc_deinit(void)
 {
     if (!adc_initialized) {
@@ -185,85 +252,30 @@ void adc_deinit(void)
     adc_initialized = false;
 }
 
-static esp_err_t load_calibration_from_nvs(void) {
-    nvs_handle_t nvs_handle;
-    esp_err_t err;
+// Read once at boot by the settings, or kept over deep sleep
+static esp_err_t load_calibration(void) {
+    settings_t settings;
 
-    // Open NVS
-    err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
-    if (err != ESP_OK) {
-        return err;
-    }
-
-    // Try to read calibration flag
-    uint8_t is_calibrated = 0;
-    err = nvs_get_u8(nvs_handle, NVS_KEY_CALIBRATED, &is_calibrated);
-    if (err != ESP_OK || !is_calibrated) {
-        nvs_close(nvs_handle);
+    settings_get(&settings);
+    if (!settings.adc_calibrated) {
         return ESP_ERR_NOT_FOUND;
     }
-
-    // Read calibration values
-    err = nvs_get_u32(nvs_handle, NVS_KEY_MIN, &adc_input_min_value);
-    if (err != ESP_OK) {
-        nvs_close(nvs_handle);
-        return err;
-    }
-
-    err = nvs_get_u32(nvs_handle, NVS_KEY_MAX, &adc_input_max_value);
-    if (err != ESP_OK) {
-        nvs_close(nvs_handle);
-        return err;
-    }
-
-    nvs_close(nvs_handle);
+    adc_input_min_value = settings.adc_min;
+    adc_input_max_value = settings.adc_max;
     calibration_done = true;
     return ESP_OK;
 }
 
-static esp_err_t save_calibration_to_nvs(void) {
-    nvs_handle_t nvs_handle;
-    esp_err_t err;
-
-    // Open NVS
-    err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
-    if (err != ESP_OK) {
-        return err;
-    }
-
-    // Save calibration values
-    err = nvs_set_u32(nvs_handle, NVS_KEY_MIN, adc_input_min_value);
-    if (err != ESP_OK) {
-        nvs_close(nvs_handle);
-        return err;
-    }
-
-    err = nvs_set_u32(nvs_handle, NVS_KEY_MAX, adc_input_max_value);
-    if (err != ESP_OK) {
-        nvs_close(nvs_handle);
-        return err;
-    }
-
-    // Set calibration flag
-    err = nvs_set_u8(nvs_handle, NVS_KEY_CALIBRATED, 1);
-    if (err != ESP_OK) {
-        nvs_close(nvs_handle);
-        return err;
-    }
-
-    // Commit changes
-    err = nvs_commit(nvs_handle);
-    nvs_close(nvs_handle);
-    return err;
-}
-
 void adc_calibrate(void) {
-    // First try to load calibration from NVS
-    if (load_calibration_from_nvs() == ESP_OK) {
-        ESP_LOGI(TAG, "Loaded calibration from NVS");
+    // First try the stored calibration
+    if (load_calibration() == ESP_OK) {
+        ESP_LOGI(TAG, "Loaded calibration from settings");
         return;
     }
+    run_calibration();
+}
 
+static void run_calibration(void) {
     ESP_LOGI(TAG, "Starting ADC calibration...");
     ESP_LOGI(TAG, "Please move throttle through full range during the next 6 seconds");
 
@@ -298,6 +310,8 @@ void adc_calibrate(void) {
         adc_input_max_value = max_value - (range * 0.05);
 
         calibration_done = true;
+        // Written to NVS once, with the next settings save
+        settings_set_adc_calibration(adc_input_min_value, adc_input_max_value);
 
         ESP_LOGI(TAG, "ADC calibration complete:");
         ESP_LOGI(TAG, "Raw min value: %lu", min_value);
@@ -307,48 +321,16 @@ void adc_calibrate(void) {
     } else {
         ESP_LOGE(TAG, "ADC calibration failed - invalid readings");
     }
-
-    // Save calibration to NVS
-    if (save_calibration_to_nvs() != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to save calibration to NVS");
-    }
-
-    // After successful calibration, save to NVS
-    if (calibration_done) {
-        if (save_calibration_to_nvs() == ESP_OK) {
-            ESP_LOGI(TAG, "Calibration saved to NVS");
-        } else {
-            ESP_LOGE(TAG, "Failed to save calibration to NVS");
-        }
-    }
 }
 
 bool adc_is_calibrated(void) {
     return calibration_done;
 }
 
-uint8_t map_adc_value(uint32_t adc_value) {
-    // Constrain input value to the calibrated range
-    if (adc_value < adc_input_min_value) {
-        adc_value = adc_input_min_value;
-    }
-    if (adc_value > adc_input_max_value) {
-        adc_value = adc_input_max_value;
-    }
-
-    // Perform the mapping
-    uint8_t mapped = (uint8_t)((adc_value - adc_input_min_value) *
-           (ADC_OUTPUT_MAX_VALUE - ADC_OUTPUT_MIN_VALUE - ADC_THROTTLE_OFFSET) /
-           (adc_input_max_value - adc_input_min_value) +
-           ADC_OUTPUT_MIN_VALUE);
+bool adc_is_ready(void) {
+    return calibration_done && sampling;
+}
 
-    // Add offset only to non-zero values to maintain 0 at minimum
-    if (mapped > 0) {
-        mapped += ADC_THROTTLE_OFFSET;
-    }
-    
-    // Constrain the final value to 0-255
-    if (mapped > 255) mapped = 255;
-    
-    return mapped;
+uint8_t map_adc_value(uint32_t adc_value) {
+    return throttle_map(adc_value, adc_input_min_value, adc_input_max_value);
 }
\ No newline at end of file
@@ -5,12 +5,11 @@
 #include "esp_err.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
-#include "nvs_flash.h"
-#include "nvs.h"
 
 #define CALIBRATE_ADC 0
 
-#define ADC_SAMPLING_TICKS 20
+// Throttle movement and display wake-up, the sends take their own sample
+#define ADC_SAMPLING_MS 20
 #define THROTTLE_PIN ADC_CHANNEL_2
 #define BATTERY_PIN  ADC_CHANNEL_3
 
@@ -18,26 +17,38 @@
 #define ADC_INITIAL_MAX_VALUE 4095  // 12-bit ADC max
 #define ADC_INITIAL_MIN_VALUE 0
 
-#define ADC_OUTPUT_MAX_VALUE 255
-#define ADC_OUTPUT_MIN_VALUE 0
-
 // Calibration settings
 #define ADC_CALIBRATION_SAMPLES 300  // 300 samples over 6 seconds = 1 sample every 20ms
 #define ADC_CALIBRATION_DELAY_MS 20  // 20ms between samples
 
-#define NVS_NAMESPACE "adc_cal"
-#define NVS_KEY_MIN "min_val"
-#define NVS_KEY_MAX "max_val"
-#define NVS_KEY_CALIBRATED "cal_done"
+// Controller battery, read every BATTERY_SAMPLE_INTERVAL throttle samples.
+// Raw 12 dB readings of a 3.3 V (empty) and 4.2 V (full) cell behind a 1:2
+// divider, adjust for the board.
+#define BATTERY_SAMPLE_INTERVAL 50
+#define BATTERY_ADC_EMPTY 2170
+#define BATTERY_ADC_FULL  2760
 
-#define ADC_THROTTLE_OFFSET 18
+// Level below which the display is lit briefly to warn the rider
+#define BATTERY_ALERT_PERCENT 10
 
 esp_err_t adc_init(void);
 int32_t adc_read_value(void);
+// Initialises, calibrates if needed and schedules sampling. Blocks for the
+// calibration, up to ADC_CALIBRATION_SAMPLES * ADC_CALIBRATION_DELAY_MS.
 void adc_start_task(void);
 uint32_t adc_get_latest_value(void);
+
+// Take a throttle sample now and make it the latest value. Control worker
+// only, once adc_is_ready().
+void adc_sample_throttle(void);
 uint8_t map_adc_value(uint32_t adc_value);
 void adc_calibrate(void);
 bool adc_is_calibrated(void);
 
+// Calibrated and sampled at least once, the throttle value can be sent
+bool adc_is_ready(void);
+
+// Controller battery level in percent, -1 until the first reading
+int32_t adc_get_battery_percent(void);
+
 #endif // ADC_H
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include "asset_pack.h"
+#include <string.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+
+#define TAG "ASSET_PACK"
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t layout_id;
+    uint32_t size;
+    uint32_t crc;
+} pack_header_t;
+
+typedef struct {
+    char name[ASSET_PACK_NAME_LEN];
+    uint32_t offset;
+    uint32_t size;
+} pack_entry_t;
+
+_Static_assert(sizeof(pack_header_t) == 20, "pack header must match tools/asset_pack.py");
+_Static_assert(sizeof(pack_entry_t) == 40, "pack entry must match tools/asset_pack.py");
+
+static esp_partition_mmap_handle_t mmap_handle;
+
+static const pack_entry_t *find_entry(const pack_entry_t *entries, uint16_t count, const char *name) {
+    for (uint16_t i = 0; i < count; i++) {
+        if (strncmp(entries[i].name, name, ASSET_PACK_NAME_LEN) == 0) {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+// Without glyph bitmaps a font must not find any glyph, or LVGL would read from NULL
+static void disable_assets(void) {
+    for (size_t i = 0; i < asset_binding_count; i++) {
+        const asset_binding_t *binding = asset_bindings[i];
+        if (binding->img != NULL) {
+            binding->img->data = NULL;
+        }
+        if (binding->font != NULL) {
+            binding->font->cmap_num = 0;
+        }
+    }
+}
+
+static esp_err_t check_header(const esp_partition_t *partition, pack_header_t *header) {
+    esp_err_t ret = esp_partition_read(partition, 0, header, sizeof(*header));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (header->magic != ASSET_PACK_MAGIC || header->version != ASSET_PACK_VERSION) {
+        ESP_LOGE(TAG, "No asset pack in partition, run idf.py assets-flash");
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (header->layout_id != asset_pack_layout_id) {
+        ESP_LOGE(TAG, "Asset pack layout %08lx does not match the app (%08lx)",
+                 (unsigned long)header->layout_id, (unsigned long)asset_pack_layout_id);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (header->size > partition->size ||
+        header->size < sizeof(*header) + header->count * sizeof(pack_entry_t)) {
+        ESP_LOGE(TAG, "Invalid asset pack size %lu", (unsigned long)header->size);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    return ESP_OK;
+}
+
+esp_err_t asset_pack_init(void) {
+    const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                                ASSET_PACK_PARTITION);
+    pack_header_t header;
+    const void *mapped = NULL;
+    esp_err_t ret;
+
+    if (partition == NULL) {
+        ESP_LOGE(TAG, "Partition '%s' not found", ASSET_PACK_PARTITION);
+        disable_assets();
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    ret = check_header(partition, &header);
+    if (ret != ESP_OK) {
+        disable_assets();
+        return ret;
+    }
+
+    // Map only the pack, the rest of the partition stays out of the MMU
+    ret = esp_partition_mmap(partition, 0, header.size, ESP_PARTITION_MMAP_DATA, &mapped, &mmap_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to map asset pack: %s", esp_err_to_name(ret));
+        disable_assets();
+        return ret;
+    }
+
+    const uint8_t *pack = mapped;
+#if ASSET_PACK_VERIFY_CRC
+    uint32_t crc = esp_rom_crc32_le(0, pack + sizeof(header), header.size - sizeof(header));
+    if (crc != header.crc) {
+        ESP_LOGE(TAG, "Asset pack CRC mismatch (%08lx, expected %08lx)", (unsigned long)crc,
+                 (unsigned long)header.crc);
+        esp_partition_munmap(mmap_handle);
+        disable_assets();
+        return ESP_ERR_INVALID_CRC;
+    }
+#endif
+
+    const pack_entry_t *entries = (const pack_entry_t *)(pack + sizeof(header));
+    for (size_t i = 0; i < asset_binding_count; i++) {
+        const asset_binding_t *binding = asset_bindings[i];
+        const pack_entry_t *entry = find_entry(entries, header.count, binding->name);
+
+        // The layout id covers names and sizes, so this only trips on a corrupt pack
+        if (entry == NULL || entry->size != binding->size || entry->offset + entry->size > header.size) {
+            ESP_LOGE(TAG, "Asset %s missing or corrupt", binding->name);
+            esp_partition_munmap(mmap_handle);
+            disable_assets();
+            return ESP_ERR_INVALID_STATE;
+        }
+
+        if (binding->img != NULL) {
+            binding->img->data = pack + entry->offset;
+        }
+        if (binding->font != NULL) {
+            binding->font->glyph_bitmap = pack + entry->offset;
+        }
+    }
+
+    ESP_LOGI(TAG, "Mapped %u assets, %lu bytes at %p", header.count, (unsigned long)header.size, mapped);
+    return ESP_OK;
+}
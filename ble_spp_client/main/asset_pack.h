@@ -0,0 +1,38 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+// Image and font data lives in the "assets" partition instead of the app.
+// tools/asset_pack.py builds the pack from the SquareLine export, the pack
+// layout is described there. Flash it with `idf.py assets-flash`.
+#define ASSET_PACK_PARTITION "assets"
+#define ASSET_PACK_MAGIC 0x50414247  // "GBAP"
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_NAME_LEN 32
+
+// Set to 1 to check the pack CRC at boot (reads the whole pack once)
+#define ASSET_PACK_VERIFY_CRC 1
+
+// Links one generated descriptor to its blob in the pack
+typedef struct {
+    const char *name;
+    uint32_t size;                // Expected blob size
+    lv_img_dsc_t *img;            // Image whose data points into the pack
+    lv_font_fmt_txt_dsc_t *font;  // Font whose glyph bitmap points into the pack
+} asset_binding_t;
+
+// Generated by tools/asset_pack.py
+extern const asset_binding_t *const asset_bindings[];
+extern const size_t asset_binding_count;
+extern const uint32_t asset_pack_layout_id;
+
+// Map the asset partition and point every image and font at it.
+// Must run before any screen is built. If the pack is missing or does not
+// match this build, images are left empty and fonts draw no glyphs.
+esp_err_t asset_pack_init(void);
+
+#endif // ASSET_PACK_H
@@ -28,6 +28,17 @@
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "adc.h"
+#include "ui_cmd.h"
+#include "display_power.h"
+#include "power.h"
+#include "executor.h"
+#include "diagnostics.h"
+#include "boot.h"
+#include "resume.h"
+#include "ride_log.h"
+#include "vesc_telemetry.h"
+#include "spp_link.h"
+#include "sim_hw.h"
 
 #define DEVICE_NAME                 "GS-THUMB"
 #define GATTC_TAG                   "GATTC_SPP_DEMO"
@@ -38,6 +49,8 @@
 #define BT_BD_ADDR_HEX(addr)        addr[0],addr[1],addr[2],addr[3],addr[4],addr[5]
 #define ESP_GATT_SPP_SERVICE_UUID   0xABF0
 #define SCAN_ALL_THE_TIME           0
+#define RSSI_PERIOD_MS              1000
+#define THROTTLE_SEND_PERIOD_MS     50
 
 struct gattc_profile_inst {
     esp_gattc_cb_t gattc_cb;
@@ -65,12 +78,26 @@ enum {
     SPP_IDX_NB,
 };
 
+_Static_assert(SPP_IDX_NB <= RESUME_MAX_ATTRS, "SPP attribute table does not fit the retained peer");
+
+// Characteristics notifications are enabled on, in this order. The client
+// configuration descriptor follows each one in the attribute table.
+static const uint8_t subscriptions[] = {
+    SPP_IDX_SPP_DATA_NTY_VAL,
+    SPP_IDX_SPP_STATUS_VAL,
+#ifdef SUPPORT_HEARTBEAT
+    SPP_IDX_SPP_HEARTBEAT_VAL,
+#endif
+};
+
 ///Declare static functions
 static void esp_gap_cb(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param);
 static void esp_gattc_cb(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *param);
 static void gattc_profile_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *param);
-static void adc_send_task(void *pvParameters);
-static void log_rssi_task(void *pvParameters);
+static void throttle_send(void *arg);
+static void read_rssi(void *arg);
+static void register_for_notify(uint16_t cmd_id);
+static void run_link(spp_link_action_t action);
 
 /* One gatt-based profile one app_id and one gattc_if, this array will store the gattc_if returned by ESP_GATTS_REG_EVT */
 static struct gattc_profile_inst gl_profile_tab[PROFILE_NUM] = {
@@ -93,17 +120,17 @@ bool is_connect = false;
 static const char device_name[] = DEVICE_NAME;
 static uint16_t spp_conn_id = 0;
 static uint16_t spp_mtu_size = 23;
-static uint16_t cmd = 0;
 static uint16_t spp_srv_start_handle = 0;
 static uint16_t spp_srv_end_handle = 0;
 static uint16_t spp_gattc_if = 0xff;
 static char * notify_value_p = NULL;
 static int notify_value_offset = 0;
 static int notify_value_count = 0;
-static uint16_t count = SPP_IDX_NB;
 static esp_gattc_db_elem_t *db = NULL;
 static esp_ble_gap_cb_param_t scan_rst;
-static QueueHandle_t cmd_reg_queue = NULL;
+static resume_peer_t resume_peer;       // Controller from before deep sleep
+static spp_link_t connection;           // Connection sequence, GAP and GATTC callbacks only
+static esp_ble_addr_type_t peer_addr_type = BLE_ADDR_TYPE_PUBLIC;  // Of the last connection opened
 QueueHandle_t spp_uart_queue = NULL;
 
 #ifdef SUPPORT_HEARTBEAT
@@ -116,14 +143,15 @@ static esp_bt_uuid_t spp_service_uuid = {
     .uuid = {.uuid16 = ESP_GATT_SPP_SERVICE_UUID,},
 };
 
-static float latest_voltage = 0.0f;
-static int32_t latest_erpm = 0;
-static float latest_current_motor = 0.0f;
-static float latest_current_in = 0.0f;
-static float latest_amp_hours = 0.0f;
-static float latest_amp_hours_charged = 0.0f;
+// Latest telemetry as received, in hundredths of the unit (V, A, Ah)
+static vesc_telemetry_t latest;
 static int connection_quality = 0;
 
+// Separate locks since esp_pm locks are not recursive and the two paths
+// run in different tasks
+static esp_pm_lock_handle_t tx_pm_lock = NULL;
+static esp_pm_lock_handle_t rx_pm_lock = NULL;
+
 static void notify_event_handler(esp_ble_gattc_cb_param_t * p_data)
 {
     uint8_t handle = 0;
@@ -141,37 +169,15 @@ static void notify_event_handler(esp_ble_gattc_cb_param_t * p_data)
     }
 
     if(handle == db[SPP_IDX_SPP_DATA_NTY_VAL].attribute_handle){
-        // Check if we received the expected 14 bytes
-        if(p_data->notify.value_len == 14) {
-            // Decode voltage (first 2 bytes)
-            int16_t voltage_raw = (p_data->notify.value[0] << 8) | p_data->notify.value[1];
-            latest_voltage = voltage_raw / 100.0f;
-
-            // Decode RPM (next 4 bytes)
-            latest_erpm = (p_data->notify.value[2] << 24) |
-                        (p_data->notify.value[3] << 16) |
-                        (p_data->notify.value[4] << 8) |
-                        p_data->notify.value[5];
-
-            // Decode current_motor (next 2 bytes)
-            int16_t current_motor_raw = (p_data->notify.value[6] << 8) | p_data->notify.value[7];
-            latest_current_motor = current_motor_raw / 100.0f;
-
-            // Decode current_in (next 2 bytes)
-            int16_t current_in_raw = (p_data->notify.value[8] << 8) | p_data->notify.value[9];
-            latest_current_in = current_in_raw / 100.0f;
-
-            // Decode amp_hours (next 2 bytes)
-            int16_t amp_hours_raw = (p_data->notify.value[10] << 8) | p_data->notify.value[11];
-            latest_amp_hours = amp_hours_raw / 100.0f;
-
-            // Decode amp_hours_charged (last 2 bytes)
-            int16_t amp_hours_charged_raw = (p_data->notify.value[12] << 8) | p_data->notify.value[13];
-            latest_amp_hours_charged = amp_hours_charged_raw / 100.0f;
-
-            ESP_LOGI(GATTC_TAG, "Received: V=%.2fV, RPM=%ld, Motor=%.2fA, In=%.2fA, AH=%.2f, AHC=%.2f",
-                    latest_voltage, latest_erpm, latest_current_motor, latest_current_in,
-                    latest_amp_hours, latest_amp_hours_charged);
+        if (vesc_telemetry_decode(p_data->notify.value, p_data->notify.value_len, &latest)) {
+            ESP_LOGI(GATTC_TAG, "Received: V=%d cV, RPM=%ld, Motor=%d cA, In=%d cA, AH=%d cAh, AHC=%d cAh",
+                    latest.voltage_cv, latest.erpm, latest.current_motor_ca, latest.current_in_ca,
+                    latest.amp_hours_cah, latest.amp_hours_charged_cah);
+
+            // Wake the LVGL task to push the new values to the bound labels
+            diagnostics_count(DIAG_BLE_RX);
+            diagnostics_notify_received();
+            ui_cmd_simple(UI_CMD_REFRESH_BINDINGS);
         } else {
             ESP_LOGW(GATTC_TAG, "Unexpected data length: %d", p_data->notify.value_len);
         }
@@ -181,10 +187,12 @@ static void notify_event_handler(esp_ble_gattc_cb_param_t * p_data)
 static void free_gattc_srv_db(void)
 {
     is_connect = false;
+    // Show the disconnect in the status bar right away, the rider needs to see it
+    display_power_set_riding(false);
+    ui_cmd_simple(UI_CMD_REFRESH_BINDINGS);
     spp_gattc_if = 0xff;
     spp_conn_id = 0;
     spp_mtu_size = 23;
-    cmd = 0;
     spp_srv_start_handle = 0;
     spp_srv_end_handle = 0;
     notify_value_p = NULL;
@@ -208,10 +216,7 @@ static void esp_gap_cb(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *par
             ESP_LOGE(GATTC_TAG, "Scan param set failed: %s", esp_err_to_name(err));
             break;
         }
-        //the unit of the duration is second
-        uint32_t duration = 0xFFFF;
-        ESP_LOGI(GATTC_TAG, "Enable Ble Scan:during time %04" PRIx32 " minutes.",duration);
-        esp_ble_gap_start_scanning(duration);
+        run_link(spp_link_scan_params_set(&connection));
         break;
     }
     case ESP_GAP_BLE_SCAN_START_COMPLETE_EVT:
@@ -228,10 +233,7 @@ static void esp_gap_cb(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *par
             break;
         }
         ESP_LOGI(GATTC_TAG, "Scan stop successfully");
-        if (is_connect == false) {
-            ESP_LOGI(GATTC_TAG, "Connect to the remote device.");
-            esp_ble_gattc_open(gl_profile_tab[PROFILE_APP_ID].gattc_if, scan_rst.scan_rst.bda, scan_rst.scan_rst.ble_addr_type, true);
-        }
+        run_link(spp_link_scan_stopped(&connection));
         break;
     case ESP_GAP_BLE_SCAN_RESULT_EVT: {
         esp_ble_gap_cb_param_t *scan_result = (esp_ble_gap_cb_param_t *)param;
@@ -243,8 +245,10 @@ static void esp_gap_cb(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *par
             if (adv_name != NULL && strncmp((char *)adv_name, device_name, adv_name_len) == 0) {
                 ESP_LOGI(GATTC_TAG, "Found device %s, RSSI: %d",
                         device_name, scan_result->scan_rst.rssi);
-                memcpy(&scan_rst, scan_result, sizeof(esp_ble_gap_cb_param_t));
-                esp_ble_gap_stop_scanning();
+                if (connection.state == SPP_LINK_SCANNING) {
+                    memcpy(&scan_rst, scan_result, sizeof(esp_ble_gap_cb_param_t));
+                }
+                run_link(spp_link_found(&connection));
             }
             break;
         case ESP_GAP_SEARCH_INQ_CMPL_EVT:
@@ -308,6 +312,44 @@ static void esp_gattc_cb(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp
     } while (0);
 }
 
+// Attribute table of the controller from before deep sleep, instead of a
+// service discovery
+static bool restore_db(const uint8_t *remote_bda)
+{
+    if (resume_peer.attr_count != SPP_IDX_NB || memcmp(resume_peer.bda, remote_bda, sizeof(esp_bd_addr_t)) != 0) {
+        return false;
+    }
+    db = (esp_gattc_db_elem_t *)calloc(SPP_IDX_NB, sizeof(esp_gattc_db_elem_t));
+    if (db == NULL) {
+        return false;
+    }
+    for (int i = 0; i < SPP_IDX_NB; i++) {
+        db[i].attribute_handle = resume_peer.handles[i];
+        db[i].properties = resume_peer.properties[i];
+    }
+    spp_srv_start_handle = resume_peer.service_start;
+    spp_srv_end_handle = resume_peer.service_end;
+    return true;
+}
+
+// Kept for a direct connection and no discovery after the next deep sleep
+static void retain_peer(void)
+{
+    resume_peer_t peer = {
+        .addr_type = peer_addr_type,
+        .service_start = spp_srv_start_handle,
+        .service_end = spp_srv_end_handle,
+        .attr_count = SPP_IDX_NB,
+    };
+
+    memcpy(peer.bda, gl_profile_tab[PROFILE_APP_ID].remote_bda, sizeof(peer.bda));
+    for (int i = 0; i < SPP_IDX_NB; i++) {
+        peer.handles[i] = db[i].attribute_handle;
+        peer.properties[i] = db[i].properties;
+    }
+    resume_set_peer(&peer);
+}
+
 static void gattc_profile_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *param)
 {
     esp_ble_gattc_cb_param_t *p_data = (esp_ble_gattc_cb_param_t *)param;
@@ -323,14 +365,22 @@ static void gattc_profile_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_
         esp_log_buffer_hex(GATTC_TAG, gl_profile_tab[PROFILE_APP_ID].remote_bda, sizeof(esp_bd_addr_t));
         spp_gattc_if = gattc_if;
         is_connect = true;
+        ui_cmd_simple(UI_CMD_REFRESH_BINDINGS);
         spp_conn_id = p_data->connect.conn_id;
         memcpy(gl_profile_tab[PROFILE_APP_ID].remote_bda, p_data->connect.remote_bda, sizeof(esp_bd_addr_t));
-        esp_ble_gattc_search_service(spp_gattc_if, spp_conn_id, &spp_service_uuid);
+        boot_mark(BOOT_STAGE_CONNECTED);
+        run_link(spp_link_connected(&connection));
+        break;
+    case ESP_GATTC_OPEN_EVT:
+        if (p_data->open.status != ESP_GATT_OK) {
+            ESP_LOGW(GATTC_TAG, "Open failed, status %d", p_data->open.status);
+            run_link(spp_link_open_failed(&connection));
+        }
         break;
     case ESP_GATTC_DISCONNECT_EVT:
         ESP_LOGI(GATTC_TAG, "disconnect");
         free_gattc_srv_db();
-        esp_ble_gap_start_scanning(SCAN_ALL_THE_TIME);
+        run_link(spp_link_disconnected(&connection));
         break;
     case ESP_GATTC_SEARCH_RES_EVT:
         ESP_LOGI(GATTC_TAG, "ESP_GATTC_SEARCH_RES_EVT: start_handle = %d, end_handle = %d, UUID:0x%04x",p_data->search_res.start_handle,p_data->search_res.end_handle,p_data->search_res.srvc_id.uuid.uuid.uuid16);
@@ -339,29 +389,20 @@ static void gattc_profile_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_
         break;
     case ESP_GATTC_SEARCH_CMPL_EVT:
         ESP_LOGI(GATTC_TAG, "SEARCH_CMPL: conn_id = %x, status %d", spp_conn_id, p_data->search_cmpl.status);
-        esp_ble_gattc_send_mtu_req(gattc_if, spp_conn_id);
+        run_link(spp_link_search_done(&connection));
         break;
-    case ESP_GATTC_REG_FOR_NOTIFY_EVT: {
-        ESP_LOGI(GATTC_TAG,"Index = %d,status = %d,handle = %d",cmd, p_data->reg_for_notify.status, p_data->reg_for_notify.handle);
+    case ESP_GATTC_REG_FOR_NOTIFY_EVT:
+        ESP_LOGI(GATTC_TAG,"Step = %d,status = %d,handle = %d",(int)connection.step, p_data->reg_for_notify.status, p_data->reg_for_notify.handle);
         if(p_data->reg_for_notify.status != ESP_GATT_OK){
             ESP_LOGE(GATTC_TAG, "ESP_GATTC_REG_FOR_NOTIFY_EVT, status = %d", p_data->reg_for_notify.status);
-            break;
         }
-        uint16_t notify_en = 1;
-        esp_ble_gattc_write_char_descr(
-                spp_gattc_if,
-                spp_conn_id,
-                (db+cmd+1)->attribute_handle,
-                sizeof(notify_en),
-                (uint8_t *)&notify_en,
-                ESP_GATT_WRITE_TYPE_NO_RSP,
-                ESP_GATT_AUTH_REQ_NONE);
-
+        run_link(spp_link_notify_registered(&connection, p_data->reg_for_notify.status == ESP_GATT_OK));
         break;
-    }
     case ESP_GATTC_NOTIFY_EVT:
         ESP_LOGI(GATTC_TAG,"ESP_GATTC_NOTIFY_EVT");
+        power_lock_acquire(rx_pm_lock);
         notify_event_handler(p_data);
+        power_lock_release(rx_pm_lock);
         break;
     case ESP_GATTC_READ_CHAR_EVT:
         ESP_LOGI(GATTC_TAG,"ESP_GATTC_READ_CHAR_EVT");
@@ -381,110 +422,172 @@ static void gattc_profile_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_
         ESP_LOGI(GATTC_TAG,"ESP_GATTC_WRITE_DESCR_EVT: status =%d,handle = %d", p_data->write.status, p_data->write.handle);
         if(p_data->write.status != ESP_GATT_OK){
             ESP_LOGE(GATTC_TAG, "ESP_GATTC_WRITE_DESCR_EVT, error status = %d", p_data->write.status);
-            break;
         }
-        switch(cmd){
-        case SPP_IDX_SPP_DATA_NTY_VAL:
-            cmd = SPP_IDX_SPP_STATUS_VAL;
-            xQueueSend(cmd_reg_queue, &cmd,10/portTICK_PERIOD_MS);
-            break;
-        case SPP_IDX_SPP_STATUS_VAL:
+        run_link(spp_link_cccd_written(&connection, p_data->write.status == ESP_GATT_OK));
 #ifdef SUPPORT_HEARTBEAT
-            cmd = SPP_IDX_SPP_HEARTBEAT_VAL;
-            xQueueSend(cmd_reg_queue, &cmd, 10/portTICK_PERIOD_MS);
-#endif
-            break;
-#ifdef SUPPORT_HEARTBEAT
-        case SPP_IDX_SPP_HEARTBEAT_VAL:
-            xQueueSend(cmd_heartbeat_queue, &cmd, 10/portTICK_PERIOD_MS);
-            break;
+        if (spp_link_is_ready(&connection)) {
+            uint16_t cmd_id = SPP_IDX_SPP_HEARTBEAT_VAL;
+            xQueueSend(cmd_heartbeat_queue, &cmd_id, 10/portTICK_PERIOD_MS);
+        }
 #endif
-        default:
-            break;
-        };
         break;
     case ESP_GATTC_CFG_MTU_EVT:
-        if(p_data->cfg_mtu.status != ESP_OK){
-            break;
-        }
-        ESP_LOGI(GATTC_TAG,"+MTU:%d", p_data->cfg_mtu.mtu);
-        spp_mtu_size = p_data->cfg_mtu.mtu;
-
-        db = (esp_gattc_db_elem_t *)malloc(count*sizeof(esp_gattc_db_elem_t));
-        if(db == NULL){
-            ESP_LOGE(GATTC_TAG,"%s:malloc db failed",__func__);
-            break;
-        }
-        if(esp_ble_gattc_get_db(spp_gattc_if, spp_conn_id, spp_srv_start_handle, spp_srv_end_handle, db, &count) != ESP_GATT_OK){
-            ESP_LOGE(GATTC_TAG,"%s:get db failed",__func__);
-            break;
+        // The default MTU is enough for the throttle and telemetry
+        if(p_data->cfg_mtu.status == ESP_OK){
+            ESP_LOGI(GATTC_TAG,"+MTU:%d", p_data->cfg_mtu.mtu);
+            spp_mtu_size = p_data->cfg_mtu.mtu;
         }
-        if(count != SPP_IDX_NB){
-            ESP_LOGE(GATTC_TAG,"%s:get db count != SPP_IDX_NB, count = %d, SPP_IDX_NB = %d",__func__,count,SPP_IDX_NB);
-            break;
-        }
-        for(int i = 0;i < SPP_IDX_NB;i++){
-            switch((db+i)->type){
-            case ESP_GATT_DB_PRIMARY_SERVICE:
-                ESP_LOGI(GATTC_TAG,"attr_type = PRIMARY_SERVICE,attribute_handle=%d,start_handle=%d,end_handle=%d,properties=0x%x,uuid=0x%04x",\
-                        (db+i)->attribute_handle, (db+i)->start_handle, (db+i)->end_handle, (db+i)->properties, (db+i)->uuid.uuid.uuid16);
-                break;
-            case ESP_GATT_DB_SECONDARY_SERVICE:
-                ESP_LOGI(GATTC_TAG,"attr_type = SECONDARY_SERVICE,attribute_handle=%d,start_handle=%d,end_handle=%d,properties=0x%x,uuid=0x%04x",\
-                        (db+i)->attribute_handle, (db+i)->start_handle, (db+i)->end_handle, (db+i)->properties, (db+i)->uuid.uuid.uuid16);
-                break;
-            case ESP_GATT_DB_CHARACTERISTIC:
-                ESP_LOGI(GATTC_TAG,"attr_type = CHARACTERISTIC,attribute_handle=%d,start_handle=%d,end_handle=%d,properties=0x%x,uuid=0x%04x",\
-                        (db+i)->attribute_handle, (db+i)->start_handle, (db+i)->end_handle, (db+i)->properties, (db+i)->uuid.uuid.uuid16);
-                break;
-            case ESP_GATT_DB_DESCRIPTOR:
-                ESP_LOGI(GATTC_TAG,"attr_type = DESCRIPTOR,attribute_handle=%d,start_handle=%d,end_handle=%d,properties=0x%x,uuid=0x%04x",\
-                        (db+i)->attribute_handle, (db+i)->start_handle, (db+i)->end_handle, (db+i)->properties, (db+i)->uuid.uuid.uuid16);
-                break;
-            case ESP_GATT_DB_INCLUDED_SERVICE:
-                ESP_LOGI(GATTC_TAG,"attr_type = INCLUDED_SERVICE,attribute_handle=%d,start_handle=%d,end_handle=%d,properties=0x%x,uuid=0x%04x",\
-                        (db+i)->attribute_handle, (db+i)->start_handle, (db+i)->end_handle, (db+i)->properties, (db+i)->uuid.uuid.uuid16);
-                break;
-            case ESP_GATT_DB_ALL:
-                ESP_LOGI(GATTC_TAG,"attr_type = ESP_GATT_DB_ALL,attribute_handle=%d,start_handle=%d,end_handle=%d,properties=0x%x,uuid=0x%04x",\
-                        (db+i)->attribute_handle, (db+i)->start_handle, (db+i)->end_handle, (db+i)->properties, (db+i)->uuid.uuid.uuid16);
-                break;
-            default:
-                break;
-            }
-        }
-        cmd = SPP_IDX_SPP_DATA_NTY_VAL;
-        xQueueSend(cmd_reg_queue, &cmd, 10/portTICK_PERIOD_MS);
+        run_link(spp_link_mtu_done(&connection));
         break;
     case ESP_GATTC_SRVC_CHG_EVT:
+        // The retained handles may be stale, discover again after the next wake
+        resume_forget_peer();
         break;
     default:
         break;
     }
 }
 
-void spp_client_reg_task(void* arg)
+// Attribute table of the discovered service
+static bool load_db(void)
 {
-    uint16_t cmd_id;
-    for(;;) {
-        vTaskDelay(100 / portTICK_PERIOD_MS);
-        if(xQueueReceive(cmd_reg_queue, &cmd_id, portMAX_DELAY)) {
-            if(db != NULL) {
-                if(cmd_id == SPP_IDX_SPP_DATA_NTY_VAL){
-                    ESP_LOGI(GATTC_TAG,"Index = %d,UUID = 0x%04x, handle = %d", cmd_id, (db+SPP_IDX_SPP_DATA_NTY_VAL)->uuid.uuid.uuid16, (db+SPP_IDX_SPP_DATA_NTY_VAL)->attribute_handle);
-                    esp_ble_gattc_register_for_notify(spp_gattc_if, gl_profile_tab[PROFILE_APP_ID].remote_bda, (db+SPP_IDX_SPP_DATA_NTY_VAL)->attribute_handle);
-                }else if(cmd_id == SPP_IDX_SPP_STATUS_VAL){
-                    ESP_LOGI(GATTC_TAG,"Index = %d,UUID = 0x%04x, handle = %d", cmd_id, (db+SPP_IDX_SPP_STATUS_VAL)->uuid.uuid.uuid16, (db+SPP_IDX_SPP_STATUS_VAL)->attribute_handle);
-                    esp_ble_gattc_register_for_notify(spp_gattc_if, gl_profile_tab[PROFILE_APP_ID].remote_bda, (db+SPP_IDX_SPP_STATUS_VAL)->attribute_handle);
-                }
+    uint16_t count = SPP_IDX_NB;
+
+    db = (esp_gattc_db_elem_t *)malloc(count*sizeof(esp_gattc_db_elem_t));
+    if(db == NULL){
+        ESP_LOGE(GATTC_TAG,"%s:malloc db failed",__func__);
+        return false;
+    }
+    if(esp_ble_gattc_get_db(spp_gattc_if, spp_conn_id, spp_srv_start_handle, spp_srv_end_handle, db, &count) != ESP_GATT_OK){
+        ESP_LOGE(GATTC_TAG,"%s:get db failed",__func__);
+        return false;
+    }
+    if(count != SPP_IDX_NB){
+        ESP_LOGE(GATTC_TAG,"%s:get db count != SPP_IDX_NB, count = %d, SPP_IDX_NB = %d",__func__,count,SPP_IDX_NB);
+        return false;
+    }
+    for(int i = 0;i < SPP_IDX_NB;i++){
+        switch((db+i)->type){
+        case ESP_GATT_DB_PRIMARY_SERVICE:
+            ESP_LOGI(GATTC_TAG,"attr_type = PRIMARY_SERVICE,attribute_handle=%d,start_handle=%d,end_handle=%d,properties=0x%x,uuid=0x%04x",\
+                    (db+i)->attribute_handle, (db+i)->start_handle, (db+i)->end_handle, (db+i)->properties, (db+i)->uuid.uuid.uuid16);
+            break;
+        case ESP_GATT_DB_SECONDARY_SERVICE:
+            ESP_LOGI(GATTC_TAG,"attr_type = SECONDARY_SERVICE,attribute_handle=%d,start_handle=%d,end_handle=%d,properties=0x%x,uuid=0x%04x",\
+                    (db+i)->attribute_handle, (db+i)->start_handle, (db+i)->end_handle, (db+i)->properties, (db+i)->uuid.uuid.uuid16);
+            break;
+        case ESP_GATT_DB_CHARACTERISTIC:
+            ESP_LOGI(GATTC_TAG,"attr_type = CHARACTERISTIC,attribute_handle=%d,start_handle=%d,end_handle=%d,properties=0x%x,uuid=0x%04x",\
+                    (db+i)->attribute_handle, (db+i)->start_handle, (db+i)->end_handle, (db+i)->properties, (db+i)->uuid.uuid.uuid16);
+            break;
+        case ESP_GATT_DB_DESCRIPTOR:
+            ESP_LOGI(GATTC_TAG,"attr_type = DESCRIPTOR,attribute_handle=%d,start_handle=%d,end_handle=%d,properties=0x%x,uuid=0x%04x",\
+                    (db+i)->attribute_handle, (db+i)->start_handle, (db+i)->end_handle, (db+i)->properties, (db+i)->uuid.uuid.uuid16);
+            break;
+        case ESP_GATT_DB_INCLUDED_SERVICE:
+            ESP_LOGI(GATTC_TAG,"attr_type = INCLUDED_SERVICE,attribute_handle=%d,start_handle=%d,end_handle=%d,properties=0x%x,uuid=0x%04x",\
+                    (db+i)->attribute_handle, (db+i)->start_handle, (db+i)->end_handle, (db+i)->properties, (db+i)->uuid.uuid.uuid16);
+            break;
+        case ESP_GATT_DB_ALL:
+            ESP_LOGI(GATTC_TAG,"attr_type = ESP_GATT_DB_ALL,attribute_handle=%d,start_handle=%d,end_handle=%d,properties=0x%x,uuid=0x%04x",\
+                    (db+i)->attribute_handle, (db+i)->start_handle, (db+i)->end_handle, (db+i)->properties, (db+i)->uuid.uuid.uuid16);
+            break;
+        default:
+            break;
+        }
+    }
+    retain_peer();
+    return true;
+}
+
+static void register_notify_work(void* arg)
+{
+    uint16_t cmd_id = (uint16_t)(uintptr_t)arg;
+
+    if(db == NULL) {
+        return;
+    }
+    if(cmd_id == SPP_IDX_SPP_DATA_NTY_VAL){
+        ESP_LOGI(GATTC_TAG,"Index = %d,UUID = 0x%04x, handle = %d", cmd_id, (db+SPP_IDX_SPP_DATA_NTY_VAL)->uuid.uuid.uuid16, (db+SPP_IDX_SPP_DATA_NTY_VAL)->attribute_handle);
+        esp_ble_gattc_register_for_notify(spp_gattc_if, gl_profile_tab[PROFILE_APP_ID].remote_bda, (db+SPP_IDX_SPP_DATA_NTY_VAL)->attribute_handle);
+    }else if(cmd_id == SPP_IDX_SPP_STATUS_VAL){
+        ESP_LOGI(GATTC_TAG,"Index = %d,UUID = 0x%04x, handle = %d", cmd_id, (db+SPP_IDX_SPP_STATUS_VAL)->uuid.uuid.uuid16, (db+SPP_IDX_SPP_STATUS_VAL)->attribute_handle);
+        esp_ble_gattc_register_for_notify(spp_gattc_if, gl_profile_tab[PROFILE_APP_ID].remote_bda, (db+SPP_IDX_SPP_STATUS_VAL)->attribute_handle);
+    }
 #ifdef SUPPORT_HEARTBEAT
-                else if(cmd_id == SPP_IDX_SPP_HEARTBEAT_VAL){
-                    ESP_LOGI(GATTC_TAG,"Index = %d,UUID = 0x%04x, handle = %d", cmd_id, (db+SPP_IDX_SPP_HEARTBEAT_VAL)->uuid.uuid.uuid16, (db+SPP_IDX_SPP_HEARTBEAT_VAL)->attribute_handle);
-                    esp_ble_gattc_register_for_notify(spp_gattc_if, gl_profile_tab[PROFILE_APP_ID].remote_bda, (db+SPP_IDX_SPP_HEARTBEAT_VAL)->attribute_handle);
-                }
+    else if(cmd_id == SPP_IDX_SPP_HEARTBEAT_VAL){
+        ESP_LOGI(GATTC_TAG,"Index = %d,UUID = 0x%04x, handle = %d", cmd_id, (db+SPP_IDX_SPP_HEARTBEAT_VAL)->uuid.uuid.uuid16, (db+SPP_IDX_SPP_HEARTBEAT_VAL)->attribute_handle);
+        esp_ble_gattc_register_for_notify(spp_gattc_if, gl_profile_tab[PROFILE_APP_ID].remote_bda, (db+SPP_IDX_SPP_HEARTBEAT_VAL)->attribute_handle);
+    }
 #endif
-            }
-        }
+}
+
+// Registration is deferred out of the GATTC callback onto the background worker
+static void register_for_notify(uint16_t cmd_id)
+{
+    executor_post(EXECUTOR_BACKGROUND, register_notify_work, (void *)(uintptr_t)cmd_id);
+}
+
+// Carry out the next step of the connection sequence
+static void run_link(spp_link_action_t action)
+{
+    switch (action) {
+    case SPP_LINK_ACT_NONE:
+        break;
+    case SPP_LINK_ACT_FORGET_PEER:
+        ESP_LOGW(GATTC_TAG, "Last controller did not answer, scanning");
+        resume_forget_peer();
+        esp_ble_gap_start_scanning(SCAN_ALL_THE_TIME);
+        break;
+    case SPP_LINK_ACT_START_SCAN:
+        ESP_LOGI(GATTC_TAG, "Enable BLE scan");
+        esp_ble_gap_start_scanning(SCAN_ALL_THE_TIME);
+        break;
+    case SPP_LINK_ACT_STOP_SCAN:
+        esp_ble_gap_stop_scanning();
+        break;
+    case SPP_LINK_ACT_OPEN_PEER:
+        // Woken from deep sleep, the controller is known: connect directly
+        ESP_LOGI(GATTC_TAG, "Connect to the last controller");
+        peer_addr_type = resume_peer.addr_type;
+        esp_ble_gattc_open(gl_profile_tab[PROFILE_APP_ID].gattc_if, resume_peer.bda, resume_peer.addr_type, true);
+        break;
+    case SPP_LINK_ACT_OPEN_FOUND:
+        ESP_LOGI(GATTC_TAG, "Connect to the remote device.");
+        peer_addr_type = scan_rst.scan_rst.ble_addr_type;
+        esp_ble_gattc_open(gl_profile_tab[PROFILE_APP_ID].gattc_if, scan_rst.scan_rst.bda, scan_rst.scan_rst.ble_addr_type, true);
+        break;
+    case SPP_LINK_ACT_RESTORE_ATTRS:
+        run_link(spp_link_attrs(&connection, restore_db(gl_profile_tab[PROFILE_APP_ID].remote_bda)));
+        break;
+    case SPP_LINK_ACT_SEARCH:
+        esp_ble_gattc_search_service(spp_gattc_if, spp_conn_id, &spp_service_uuid);
+        break;
+    case SPP_LINK_ACT_REQUEST_MTU:
+        esp_ble_gattc_send_mtu_req(spp_gattc_if, spp_conn_id);
+        break;
+    case SPP_LINK_ACT_LOAD_ATTRS:
+        run_link(spp_link_attrs(&connection, load_db()));
+        break;
+    case SPP_LINK_ACT_REGISTER_NOTIFY:
+        register_for_notify(subscriptions[connection.step]);
+        break;
+    case SPP_LINK_ACT_WRITE_CCCD: {
+        uint16_t notify_en = 1;
+        esp_ble_gattc_write_char_descr(
+                spp_gattc_if,
+                spp_conn_id,
+                (db+subscriptions[connection.step]+1)->attribute_handle,
+                sizeof(notify_en),
+                (uint8_t *)&notify_en,
+                ESP_GATT_WRITE_TYPE_NO_RSP,
+                ESP_GATT_AUTH_REQ_NONE);
+        break;
+    }
+    case SPP_LINK_ACT_CLOSE:
+        ESP_LOGE(GATTC_TAG, "Connection sequence failed, closing");
+        esp_ble_gattc_close(spp_gattc_if, spp_conn_id);
+        break;
     }
 }
 
@@ -533,6 +636,7 @@ void ble_client_appRegister(void)
         ESP_LOGE(GATTC_TAG, "gattc register error: %s", esp_err_to_name_r(status, err_msg, sizeof(err_msg)));
         return;
     }
+    spp_link_init(&connection, sizeof(subscriptions), resume_get_peer(&resume_peer));
     esp_ble_gattc_app_register(PROFILE_APP_ID);
 
     esp_err_t local_mtu_ret = esp_ble_gatt_set_local_mtu(200);
@@ -540,8 +644,6 @@ void ble_client_appRegister(void)
         ESP_LOGE(GATTC_TAG, "set local  MTU failed: %s", esp_err_to_name_r(local_mtu_ret, err_msg, sizeof(err_msg)));
     }
 
-    cmd_reg_queue = xQueueCreate(10, sizeof(uint32_t));
-    xTaskCreate(spp_client_reg_task, "spp_client_reg_task", 2048, NULL, 10, NULL);
 
 #ifdef SUPPORT_HEARTBEAT
     cmd_heartbeat_queue = xQueueCreate(10, sizeof(uint32_t));
@@ -549,40 +651,51 @@ void ble_client_appRegister(void)
 #endif
 }
 
-void uart_task(void *pvParameters)
+// Called by the background worker for each event in the UART driver queue
+static void uart_event_work(void *arg)
 {
     uart_event_t event;
-    for (;;) {
-        //Waiting for UART event.
-        if (xQueueReceive(spp_uart_queue, (void * )&event, (TickType_t)portMAX_DELAY)) {
-            switch (event.type) {
-            //Event of UART receiving data
-            case UART_DATA:
-                if (event.size && (is_connect == true) && (db != NULL) && ((db+SPP_IDX_SPP_DATA_RECV_VAL)->properties & (ESP_GATT_CHAR_PROP_BIT_WRITE_NR | ESP_GATT_CHAR_PROP_BIT_WRITE))) {
-                    uint8_t * temp = NULL;
-                    temp = (uint8_t *)malloc(sizeof(uint8_t)*event.size);
-                    if(temp == NULL){
-                        ESP_LOGE(GATTC_TAG, "malloc failed,%s L#%d", __func__, __LINE__);
-                        break;
-                    }
-                    memset(temp, 0x0, event.size);
-                    uart_read_bytes(UART_NUM_0,temp,event.size,portMAX_DELAY);
-                    esp_ble_gattc_write_char( spp_gattc_if,
-                                              spp_conn_id,
-                                              (db+SPP_IDX_SPP_DATA_RECV_VAL)->attribute_handle,
-                                              event.size,
-                                              temp,
-                                              ESP_GATT_WRITE_TYPE_NO_RSP,
-                                              ESP_GATT_AUTH_REQ_NONE);
-                    free(temp);
-                }
+
+    if (!xQueueReceive(spp_uart_queue, (void * )&event, 0)) {
+        return;
+    }
+    switch (event.type) {
+    //Event of UART receiving data
+    case UART_DATA:
+        if (event.size) {
+            uint8_t * temp = NULL;
+            temp = (uint8_t *)malloc(sizeof(uint8_t)*event.size);
+            if(temp == NULL){
+                ESP_LOGE(GATTC_TAG, "malloc failed,%s L#%d", __func__, __LINE__);
                 break;
-            default:
+            }
+            memset(temp, 0x0, event.size);
+            uart_read_bytes(UART_NUM_0,temp,event.size,portMAX_DELAY);
+            // The export command is for us, anything else goes to the controller
+            if (event.size >= strlen(RIDE_LOG_EXPORT_CMD) &&
+                memcmp(temp, RIDE_LOG_EXPORT_CMD, strlen(RIDE_LOG_EXPORT_CMD)) == 0) {
+                ride_log_export();
+                free(temp);
+                break;
+            }
+            if (!is_connect || db == NULL || !((db+SPP_IDX_SPP_DATA_RECV_VAL)->properties & (ESP_GATT_CHAR_PROP_BIT_WRITE_NR | ESP_GATT_CHAR_PROP_BIT_WRITE))) {
+                free(temp);
                 break;
             }
+            esp_ble_gattc_write_char( spp_gattc_if,
+                                      spp_conn_id,
+                                      (db+SPP_IDX_SPP_DATA_RECV_VAL)->attribute_handle,
+                                      event.size,
+                                      temp,
+                                      ESP_GATT_WRITE_TYPE_NO_RSP,
+                                      ESP_GATT_AUTH_REQ_NONE);
+            diagnostics_count(DIAG_BLE_TX);
+            free(temp);
         }
+        break;
+    default:
+        break;
     }
-    vTaskDelete(NULL);
 }
 
 static void spp_uart_init(void)
@@ -603,7 +716,9 @@ static void spp_uart_init(void)
     uart_param_config(UART_NUM_0, &uart_config);
     //Set UART pins
     uart_set_pin(UART_NUM_0, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
-    xTaskCreate(uart_task, "uTask", 2048, (void*)UART_NUM_0, 6, NULL);
+    if (executor_add_source(EXECUTOR_BACKGROUND, spp_uart_queue, uart_event_work, NULL) != ESP_OK) {
+        ESP_LOGE(GATTC_TAG, "UART forwarding not started");
+    }
 }
 
 void spp_client_demo_init(void)
@@ -612,11 +727,19 @@ void spp_client_demo_init(void)
 
     esp_log_level_set(GATTC_TAG, ESP_LOG_WARN);
 
+#if SIM_HW
+    // No controller under QEMU. The throttle still goes out on its worker
+    // and period, to the simulated sink.
+    tx_pm_lock = power_lock_create(ESP_PM_CPU_FREQ_MAX, "ble_tx");
+    ESP_ERROR_CHECK(executor_every(EXECUTOR_CONTROL, THROTTLE_SEND_PERIOD_MS, throttle_send, NULL));
+    return;
+#endif
+
     ESP_ERROR_CHECK(esp_bt_controller_mem_release(ESP_BT_MODE_CLASSIC_BT));
 
     esp_bt_controller_config_t bt_cfg = BT_CONTROLLER_INIT_CONFIG_DEFAULT();
 
-    nvs_flash_init();
+    // NVS is initialised by app_main, the PHY calibration data lives there
     ret = esp_bt_controller_init(&bt_cfg);
     if (ret) {
         ESP_LOGE(GATTC_TAG, "%s enable controller failed: %s", __func__, esp_err_to_name(ret));
@@ -628,6 +751,7 @@ void spp_client_demo_init(void)
         ESP_LOGE(GATTC_TAG, "%s enable controller failed: %s", __func__, esp_err_to_name(ret));
         return;
     }
+    boot_mark(BOOT_STAGE_BLE_CONTROLLER);
 
     ESP_LOGI(GATTC_TAG, "%s init bluetooth", __func__);
 
@@ -642,80 +766,116 @@ void spp_client_demo_init(void)
         return;
     }
 
+    tx_pm_lock = power_lock_create(ESP_PM_CPU_FREQ_MAX, "ble_tx");
+    rx_pm_lock = power_lock_create(ESP_PM_CPU_FREQ_MAX, "ble_rx");
+
     ble_client_appRegister();
     spp_uart_init();
-    xTaskCreate(adc_send_task, "adc_send_task", 2048, NULL, 6, NULL);
-    xTaskCreate(log_rssi_task, "log_rssi_task", 2048, NULL, 5, NULL);
+    ESP_ERROR_CHECK(executor_every(EXECUTOR_CONTROL, THROTTLE_SEND_PERIOD_MS, throttle_send, NULL));
+    ESP_ERROR_CHECK(executor_every(EXECUTOR_BACKGROUND, RSSI_PERIOD_MS, read_rssi, NULL));
 }
 
-static void adc_send_task(void *pvParameters) {
+// Runs every THROTTLE_SEND_PERIOD_MS on the control worker
+static void throttle_send(void *arg) {
     uint8_t data_buffer[2];  // Just 2 bytes for a 12-bit ADC value
+#if SIM_HW
+    bool writable = true;
+#else
+    bool writable = is_connect && db != NULL &&
+        ((db+SPP_IDX_SPP_DATA_RECV_VAL)->properties &
+         (ESP_GATT_CHAR_PROP_BIT_WRITE_NR | ESP_GATT_CHAR_PROP_BIT_WRITE));
+#endif
 
-    while (1) {
-        if (is_connect && db != NULL &&
-            ((db+SPP_IDX_SPP_DATA_RECV_VAL)->properties &
-             (ESP_GATT_CHAR_PROP_BIT_WRITE_NR | ESP_GATT_CHAR_PROP_BIT_WRITE))){
-
-            uint32_t adc_value = adc_get_latest_value();
-
-
-            // Pack the ADC value into 2 bytes (little-endian)
-            data_buffer[0] = (uint8_t)(adc_value & 0xFF);         // Low byte
-            data_buffer[1] = (uint8_t)((adc_value >> 8) & 0xFF);  // High byte
-
-            esp_ble_gattc_write_char(
-                spp_gattc_if,
-                spp_conn_id,
-                (db+SPP_IDX_SPP_DATA_RECV_VAL)->attribute_handle,
-                sizeof(data_buffer),  // 2 bytes
-                data_buffer,
-                ESP_GATT_WRITE_TYPE_NO_RSP,
-                ESP_GATT_AUTH_REQ_NONE
-            );
-        }
-        vTaskDelay(pdMS_TO_TICKS(50));
+    // Nothing is sent before the throttle is calibrated and sampled
+    if (writable && adc_is_ready()) {
+        // Fresh, a periodic sample would be up to ADC_SAMPLING_MS old
+        adc_sample_throttle();
+        uint32_t adc_value = adc_get_latest_value();
+
+
+        // Pack the ADC value into 2 bytes (little-endian)
+        data_buffer[0] = (uint8_t)(adc_value & 0xFF);         // Low byte
+        data_buffer[1] = (uint8_t)((adc_value >> 8) & 0xFF);  // High byte
+
+        // Queue the throttle at full clock, DFS must not add latency
+        power_lock_acquire(tx_pm_lock);
+#if SIM_HW
+        sim_hw_throttle_sent(adc_value);
+#else
+        esp_ble_gattc_write_char(
+            spp_gattc_if,
+            spp_conn_id,
+            (db+SPP_IDX_SPP_DATA_RECV_VAL)->attribute_handle,
+            sizeof(data_buffer),  // 2 bytes
+            data_buffer,
+            ESP_GATT_WRITE_TYPE_NO_RSP,
+            ESP_GATT_AUTH_REQ_NONE
+        );
+#endif
+        power_lock_release(tx_pm_lock);
+        diagnostics_count(DIAG_BLE_TX);
+        boot_mark(BOOT_STAGE_FIRST_THROTTLE);
     }
 }
 
 float get_latest_voltage(void)
 {
-    return latest_voltage;
+    return latest.voltage_cv / 100.0f;
 }
 
 int32_t get_latest_erpm(void)
 {
-    return latest_erpm;
+    return latest.erpm;
 }
 
 float get_latest_current_motor(void)
 {
-    return latest_current_motor;
+    return latest.current_motor_ca / 100.0f;
 }
 
 float get_latest_current_in(void)
 {
-    return latest_current_in;
+    return latest.current_in_ca / 100.0f;
 }
 
 float get_latest_amp_hours(void)
 {
-    return latest_amp_hours;
+    return latest.amp_hours_cah / 100.0f;
 }
 
 float get_latest_amp_hours_charged(void)
 {
-    return latest_amp_hours_charged;
+    return latest.amp_hours_charged_cah / 100.0f;
 }
 
-static void log_rssi_task(void *pvParameters) {
-    while (1) {
-        if (is_connect && spp_gattc_if != 0xff) {
-            esp_err_t ret = esp_ble_gap_read_rssi(scan_rst.scan_rst.bda);
-            if (ret != ESP_OK) {
-                ESP_LOGE(GATTC_TAG, "Read RSSI failed: %s", esp_err_to_name(ret));
-            }
+int32_t get_latest_voltage_dv(void)
+{
+    return latest.voltage_cv / 10;
+}
+
+int32_t get_latest_current_motor_da(void)
+{
+    return latest.current_motor_ca / 10;
+}
+
+int32_t get_latest_current_in_da(void)
+{
+    return latest.current_in_ca / 10;
+}
+
+int32_t get_latest_amp_hours_cah(void)
+{
+    return latest.amp_hours_cah;
+}
+
+static void read_rssi(void *arg) {
+    // The result comes back in esp_gap_cb. The connected peer, a direct
+    // connect after deep sleep never fills scan_rst.
+    if (is_connect && spp_gattc_if != 0xff) {
+        esp_err_t ret = esp_ble_gap_read_rssi(gl_profile_tab[PROFILE_APP_ID].remote_bda);
+        if (ret != ESP_OK) {
+            ESP_LOGE(GATTC_TAG, "Read RSSI failed: %s", esp_err_to_name(ret));
         }
-        vTaskDelay(pdMS_TO_TICKS(1000)); // Check RSSI every second
     }
 }
 
@@ -12,4 +12,10 @@ float get_latest_amp_hours(void);
 float get_latest_amp_hours_charged(void);
 int get_connection_quality(void);
 
+// Fixed-point telemetry for integer-only consumers
+int32_t get_latest_voltage_dv(void);        // decivolts
+int32_t get_latest_current_motor_da(void);  // deciamps
+int32_t get_latest_current_in_da(void);     // deciamps
+int32_t get_latest_amp_hours_cah(void);     // centiamp-hours
+
 #endif // SPP_CLIENT_DEMO_H
\ No newline at end of file
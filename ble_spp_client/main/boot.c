@@ -0,0 +1,158 @@
+#include "boot.h"
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "ui_cmd.h"
+#include "resume.h"
+
+#define TAG "BOOT"
+
+// Tasks started by boot_run() at the same time
+#define BOOT_MAX_JOBS 2
+
+// Same as app_main, which brings up the panel meanwhile. Whoever waits on
+// hardware hands the CPU to the others.
+#define BOOT_JOB_PRIORITY (tskIDLE_PRIORITY + 1)
+
+typedef struct {
+    void (*fn)(void);
+    boot_stage_t done;
+    bool in_use;
+} boot_job_t;
+
+static const char *const stage_names[BOOT_STAGE_MAX] = {
+    [BOOT_STAGE_START] = "start",
+    [BOOT_STAGE_NVS] = "nvs",
+    [BOOT_STAGE_CONFIG] = "config",
+    [BOOT_STAGE_LCD] = "lcd",
+    [BOOT_STAGE_UI] = "ui",
+    [BOOT_STAGE_FIRST_FRAME] = "first frame",
+    [BOOT_STAGE_BLE_CONTROLLER] = "ble controller",
+    [BOOT_STAGE_BLE_READY] = "ble ready",
+    [BOOT_STAGE_HOME] = "home",
+    [BOOT_STAGE_ADC_READY] = "adc ready",
+    [BOOT_STAGE_CONNECTED] = "connected",
+    [BOOT_STAGE_FIRST_THROTTLE] = "first throttle",
+};
+
+static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+static int64_t stage_us[BOOT_STAGE_MAX];  // 0 until marked
+static boot_job_t jobs[BOOT_MAX_JOBS];
+
+static uint32_t stage_ms(boot_stage_t stage) {
+    return (uint32_t)(stage_us[stage] / 1000);
+}
+
+static void check_target(boot_stage_t stage, uint32_t target_ms) {
+    if (stage_ms(stage) > target_ms) {
+        ESP_LOGW(TAG, "%s at %lu ms, target %lu ms", stage_names[stage], (unsigned long)stage_ms(stage),
+                 (unsigned long)target_ms);
+    }
+}
+
+// Everything up to the connection is local and done by now
+static void log_timeline(void) {
+#if BOOT_TIMELINE
+    int64_t prev_us = 0;
+
+    ESP_LOGI(TAG, "%s boot timeline", resume_is_warm() ? "Warm" : "Cold");
+    for (int i = 0; i < BOOT_STAGE_CONNECTED; i++) {
+        if (stage_us[i] == 0) {
+            ESP_LOGI(TAG, "%-14s      -", stage_names[i]);
+            continue;
+        }
+        // Stages overlap, the step is from the stage listed before
+        ESP_LOGI(TAG, "%-14s %6lu ms  %+6ld", stage_names[i], (unsigned long)stage_ms(i),
+                 (long)((stage_us[i] - prev_us) / 1000));
+        prev_us = stage_us[i];
+    }
+#endif
+    check_target(BOOT_STAGE_FIRST_FRAME, BOOT_TARGET_FIRST_FRAME_MS);
+}
+
+static bool is_marked(boot_stage_t stage) {
+    return stage_us[stage] != 0;
+}
+
+void boot_mark(boot_stage_t stage) {
+    if (stage >= BOOT_STAGE_MAX || is_marked(stage)) {
+        return;
+    }
+    int64_t now_us = esp_timer_get_time();
+
+    // Whoever completes a pair of stages acts on it, exactly once
+    bool show_home = false;
+    bool local_done = false;
+    taskENTER_CRITICAL(&lock);
+    if (!is_marked(stage)) {
+        stage_us[stage] = now_us;
+        show_home = (stage == BOOT_STAGE_FIRST_FRAME || stage == BOOT_STAGE_BLE_READY) &&
+                    is_marked(BOOT_STAGE_FIRST_FRAME) && is_marked(BOOT_STAGE_BLE_READY);
+        local_done = (stage == BOOT_STAGE_HOME || stage == BOOT_STAGE_ADC_READY) &&
+                     is_marked(BOOT_STAGE_HOME) && is_marked(BOOT_STAGE_ADC_READY);
+    }
+    taskEXIT_CRITICAL(&lock);
+
+    if (show_home) {
+        // The splash stays up while it covers BLE bring-up, no longer. After
+        // a wake there is no splash, the last screen is up already.
+        if (!resume_is_warm()) {
+            ui_cmd_load_screen(UI_SCREEN_HOME);
+        }
+        boot_mark(BOOT_STAGE_HOME);
+    }
+    if (local_done) {
+        log_timeline();
+    }
+    // These depend on the controller and come whenever they come
+    if (stage >= BOOT_STAGE_CONNECTED) {
+#if BOOT_TIMELINE
+        ESP_LOGI(TAG, "%-14s %6lu ms", stage_names[stage], (unsigned long)stage_ms(stage));
+#endif
+    }
+    if (stage == BOOT_STAGE_CONNECTED && resume_is_warm()) {
+        check_target(BOOT_STAGE_CONNECTED, BOOT_TARGET_WAKE_CONNECTED_MS);
+    }
+    if (stage == BOOT_STAGE_FIRST_THROTTLE) {
+        check_target(BOOT_STAGE_FIRST_THROTTLE, BOOT_TARGET_FIRST_THROTTLE_MS);
+    }
+}
+
+static void job_task(void *param) {
+    boot_job_t *job = param;
+
+    job->fn();
+    boot_mark(job->done);
+
+    taskENTER_CRITICAL(&lock);
+    job->in_use = false;
+    taskEXIT_CRITICAL(&lock);
+    vTaskDelete(NULL);
+}
+
+esp_err_t boot_run(const char *name, void (*fn)(void), boot_stage_t done, uint32_t stack_size) {
+    boot_job_t *job = NULL;
+
+    taskENTER_CRITICAL(&lock);
+    for (size_t i = 0; i < BOOT_MAX_JOBS; i++) {
+        if (!jobs[i].in_use) {
+            job = &jobs[i];
+            *job = (boot_job_t){ .fn = fn, .done = done, .in_use = true };
+            break;
+        }
+    }
+    taskEXIT_CRITICAL(&lock);
+
+    if (job == NULL) {
+        ESP_LOGE(TAG, "No free slot for %s", name);
+        return ESP_ERR_NO_MEM;
+    }
+    if (xTaskCreate(job_task, name, stack_size, job, BOOT_JOB_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to start %s", name);
+        job->in_use = false;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,44 @@
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+// Boot targets in ms since the app started, a timeline that misses one is
+// logged as a warning. The throttle target assumes the controller is
+// already advertising.
+#define BOOT_TARGET_FIRST_FRAME_MS 400
+#define BOOT_TARGET_FIRST_THROTTLE_MS 2500
+
+// Wake from deep sleep to connected, without scan and discovery
+#define BOOT_TARGET_WAKE_CONNECTED_MS 800
+
+// Set to 1 to log the boot timeline, misses are logged either way
+#define BOOT_TIMELINE 0
+
+// Stages in the order they are listed, not the order they finish in. Each
+// is recorded the first time it is marked.
+typedef enum {
+    BOOT_STAGE_START,           // app_main entered
+    BOOT_STAGE_NVS,
+    BOOT_STAGE_CONFIG,          // VESC config and asset pack
+    BOOT_STAGE_LCD,             // Panel and LVGL driver up
+    BOOT_STAGE_UI,              // Splash built, LVGL task running
+    BOOT_STAGE_FIRST_FRAME,
+    BOOT_STAGE_BLE_CONTROLLER,
+    BOOT_STAGE_BLE_READY,       // Bluedroid up, app registered, scanning
+    BOOT_STAGE_HOME,            // Splash replaced by the home screen
+    BOOT_STAGE_ADC_READY,       // Calibration over, sampling scheduled
+    BOOT_STAGE_CONNECTED,       // Link to the controller up
+    BOOT_STAGE_FIRST_THROTTLE,  // First throttle packet handed to the stack
+    BOOT_STAGE_MAX
+} boot_stage_t;
+
+// Record a stage. Any task, later marks of the same stage are ignored.
+void boot_mark(boot_stage_t stage);
+
+// Run fn on a task of its own, mark done once it returns and delete the
+// task. For init steps that block and have nothing to wait for.
+esp_err_t boot_run(const char *name, void (*fn)(void), boot_stage_t done, uint32_t stack_size);
+
+#endif // BOOT_H
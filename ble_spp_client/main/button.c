@@ -1,17 +1,16 @@
 #include "button.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
 #include "esp_log.h"
 #include "esp_sleep.h"
+#include "esp_timer.h"
 #include <string.h>
 #include <stdio.h>
-#include "ui/ui.h"
-#include "lvgl.h"
+#include "ui_cmd.h"
+#include "display_power.h"
+#include "resume.h"
+#include "sim_hw.h"
 
 #define TAG "BUTTON"
 #define DEBOUNCE_TIME_MS 20
-#define TASK_STACK_SIZE 2048
-#define TASK_PRIORITY 3
 #define MAX_CALLBACKS 4
 
 typedef struct {
@@ -20,22 +19,18 @@ typedef struct {
     bool in_use;
 } button_callback_entry_t;
 
-typedef enum {
-    SCREEN_HOME,
-    SCREEN_DETAILED,
-    SCREEN_MAX
-} screen_state_t;
-
-static screen_state_t current_screen = SCREEN_HOME;
+static button_actions_t actions;
 static button_config_t button_cfg;
-static button_state_t current_state = BUTTON_IDLE;
-static TickType_t press_start_time = 0;
-static TickType_t last_release_time = 0;
-static bool first_press_registered = false;
-static TaskHandle_t button_task_handle = NULL;
+static volatile button_state_t current_state = BUTTON_IDLE;
 static button_callback_entry_t callbacks[MAX_CALLBACKS] = {0};
 static void default_button_handler(button_event_t event, void* user_data);
 
+// Only touched from the esp_timer task, both timers run there
+static button_gesture_t gestures[BUTTON_ACTIONS_GESTURE_COUNT];
+static button_gesture_state_t gesture_state;
+static esp_timer_handle_t debounce_timer = NULL;
+static esp_timer_handle_t gesture_timer = NULL;
+
 static void notify_callbacks(button_event_t event) {
     for (int i = 0; i < MAX_CALLBACKS; i++) {
         if (callbacks[i].in_use && callbacks[i].callback) {
@@ -65,62 +60,76 @@ void button_unregister_callback(button_callback_t callback) {
     }
 }
 
-static void button_monitor_task(void* pvParameters) {
-    bool last_reading = !button_cfg.active_low;
-    bool button_pressed = false;
-    bool long_press_sent = false;
-
-    while (1) {
-        bool current_reading = gpio_get_level(button_cfg.gpio_num);
-        if (button_cfg.active_low) {
-            current_reading = !current_reading;
-        }
+static uint32_t now_ms(void) {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
 
-        if (current_reading != last_reading) {
-            vTaskDelay(pdMS_TO_TICKS(DEBOUNCE_TIME_MS));
-            current_reading = gpio_get_level(button_cfg.gpio_num);
-            if (button_cfg.active_low) {
-                current_reading = !current_reading;
-            }
-        }
+static bool read_pressed(void) {
+#if SIM_HW
+    return sim_hw_button_pressed();
+#else
+    return gpio_get_level(button_cfg.gpio_num) != button_cfg.active_low;
+#endif
+}
 
-        if (current_reading && !button_pressed) {
-            press_start_time = xTaskGetTickCount();
-            button_pressed = true;
-            long_press_sent = false;
+static void emit_event(button_event_t event, void *ctx) {
+    switch (event) {
+        case BUTTON_EVENT_PRESSED:
             current_state = BUTTON_PRESSED;
-            notify_callbacks(BUTTON_EVENT_PRESSED);
-        } else if (current_reading && button_pressed) {
-            // Check for long press while button is held
-            uint32_t press_duration = (xTaskGetTickCount() - press_start_time) * portTICK_PERIOD_MS;
-            if (!long_press_sent && press_duration >= button_cfg.long_press_time_ms) {
-                current_state = BUTTON_LONG_PRESS;
-                long_press_sent = true;
-                notify_callbacks(BUTTON_EVENT_LONG_PRESS);
-            }
-        } else if (!current_reading && button_pressed) {
-            button_pressed = false;
-            if (!long_press_sent) {
-                TickType_t current_time = xTaskGetTickCount();
-                if (first_press_registered &&
-                    (current_time - last_release_time) * portTICK_PERIOD_MS < button_cfg.double_press_time_ms) {
-                    current_state = BUTTON_DOUBLE_PRESS;
-                    first_press_registered = false;
-                    notify_callbacks(BUTTON_EVENT_DOUBLE_PRESS);
-                } else {
-                    first_press_registered = true;
-                    last_release_time = current_time;
-                }
-            }
-            notify_callbacks(BUTTON_EVENT_RELEASED);
+            break;
+        case BUTTON_EVENT_LONG_PRESS:
+            current_state = BUTTON_LONG_PRESS;
+            break;
+        case BUTTON_EVENT_RELEASED:
             current_state = BUTTON_IDLE;
-        }
+            break;
+        default:
+            break;
+    }
+    notify_callbacks(event);
+}
+
+// Level triggered on the level the button is not at. Unlike an edge, the
+// same setting also wakes the chip from light sleep.
+static void arm_interrupt(bool pressed) {
+#if !SIM_HW
+    bool wait_high = pressed == button_cfg.active_low;
+    gpio_wakeup_enable(button_cfg.gpio_num, wait_high ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+    gpio_intr_enable(button_cfg.gpio_num);
+#endif
+}
 
-        last_reading = current_reading;
-        vTaskDelay(pdMS_TO_TICKS(10));
+static void button_isr(void *arg) {
+    // A level interrupt repeats until masked, the debounce timer re-arms it
+#if !SIM_HW
+    gpio_intr_disable(button_cfg.gpio_num);
+#endif
+    esp_timer_start_once(debounce_timer, DEBOUNCE_TIME_MS * 1000);
+}
+
+static void schedule_gesture_timer(void) {
+    uint32_t next_ms = button_gesture_next_ms(&gesture_state, now_ms());
+
+    esp_timer_stop(gesture_timer);
+    if (next_ms != UINT32_MAX) {
+        esp_timer_start_once(gesture_timer, (uint64_t)next_ms * 1000);
     }
 }
 
+static void debounce_timer_cb(void *arg) {
+    // Bounces are over, a change since the last edge is real. Arming on the
+    // other level also catches a change that happens right now.
+    bool pressed = read_pressed();
+    arm_interrupt(pressed);
+    button_gesture_edge(&gesture_state, pressed, now_ms(), emit_event, NULL);
+    schedule_gesture_timer();
+}
+
+static void gesture_timer_cb(void *arg) {
+    button_gesture_tick(&gesture_state, now_ms(), emit_event, NULL);
+    schedule_gesture_timer();
+}
+
 esp_err_t button_init(const button_config_t* config) {
     if (config == NULL) {
         return ESP_ERR_INVALID_ARG;
@@ -128,6 +137,14 @@ esp_err_t button_init(const button_config_t* config) {
 
     memcpy(&button_cfg, config, sizeof(button_config_t));
 
+    // Continue the cycle from the screen shown before deep sleep
+    button_actions_init(&actions, resume_get_screen());
+
+    button_actions_gestures(gestures, config->long_press_time_ms);
+    button_gesture_init(&gesture_state, gestures, BUTTON_ACTIONS_GESTURE_COUNT, config->double_press_time_ms);
+
+    esp_err_t ret;
+#if !SIM_HW
     gpio_config_t io_conf = {
         .pin_bit_mask = (1ULL << config->gpio_num),
         .mode = GPIO_MODE_INPUT,
@@ -136,10 +153,43 @@ esp_err_t button_init(const button_config_t* config) {
         .intr_type = GPIO_INTR_DISABLE
     };
 
-    esp_err_t ret = gpio_config(&io_conf);
+    ret = gpio_config(&io_conf);
     if (ret != ESP_OK) {
         return ret;
     }
+#endif
+
+    const esp_timer_create_args_t debounce_args = {
+        .callback = debounce_timer_cb,
+        .name = "btn_debounce",
+    };
+    const esp_timer_create_args_t gesture_args = {
+        .callback = gesture_timer_cb,
+        .name = "btn_gesture",
+    };
+    ret = esp_timer_create(&debounce_args, &debounce_timer);
+    if (ret == ESP_OK) {
+        ret = esp_timer_create(&gesture_args, &gesture_timer);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Button timer creation failed");
+        return ret;
+    }
+
+#if SIM_HW
+    // Every scripted edge, as the interrupt would fire
+    sim_hw_button_set_isr(button_isr);
+#else
+    // Another driver may have installed the service already
+    ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        return ret;
+    }
+    ret = gpio_isr_handler_add(config->gpio_num, button_isr, NULL);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+#endif
 
     button_register_callback(default_button_handler, NULL);
 
@@ -154,47 +204,31 @@ uint32_t button_get_press_duration_ms(void) {
     if (current_state == BUTTON_IDLE) {
         return 0;
     }
-    return (xTaskGetTickCount() - press_start_time) * portTICK_PERIOD_MS;
+    return now_ms() - gesture_state.press_at;
 }
 
 void button_start_monitoring(void) {
-    xTaskCreate(button_monitor_task, "button_monitor", TASK_STACK_SIZE,
-                NULL, TASK_PRIORITY, &button_task_handle);
+    // Reads the level once and arms the interrupt, a button held since boot
+    // is reported as a press
+    esp_timer_start_once(debounce_timer, 0);
 }
 
 static void default_button_handler(button_event_t event, void* user_data) {
-    switch(event) {
-        case BUTTON_EVENT_PRESSED:
-            break;
-        case BUTTON_EVENT_RELEASED:
-            break;
-        case BUTTON_EVENT_LONG_PRESS:
-            lv_disp_load_scr(ui_shutdown_screen);
-            break;
-        case BUTTON_EVENT_DOUBLE_PRESS:
-            // Cycle through screens
-            current_screen = (current_screen + 1) % SCREEN_MAX;
-
-            switch(current_screen) {
-                case SCREEN_HOME:
-                    lv_disp_load_scr(ui_home_screen);
-                    break;
-                case SCREEN_DETAILED:
-                    lv_disp_load_scr(ui_detailed_home);
-                    break;
-                default:
-                    // Should never happen, but reset to home screen if it does
-                    current_screen = SCREEN_HOME;
-                    lv_disp_load_scr(ui_home_screen);
-                    break;
-            }
-            break;
+    // Long press is handled by the sleep module, which owns the shutdown
+    // sequence
+    button_action_t action = button_actions_handle(&actions, event, display_power_is_riding());
+
+    if (action.riding != BUTTON_RIDING_KEEP) {
+        display_power_set_riding(action.riding == BUTTON_RIDING_ENTER);
+    }
+    if (action.load) {
+        ui_cmd_load_screen(action.screen);
     }
 }
 
 void switch_to_screen2_callback(button_event_t event, void* user_data) {
     if (event == BUTTON_EVENT_LONG_PRESS) {
         // Switch to Screen2
-        lv_disp_load_scr(ui_shutdown_screen);
+        ui_cmd_load_screen(UI_SCREEN_SHUTDOWN);
     }
 }
\ No newline at end of file
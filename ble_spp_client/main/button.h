@@ -4,14 +4,11 @@
 #include <stdbool.h>
 #include "driver/gpio.h"
 #include "esp_err.h"
+#include "button_actions.h"
 
 // Button GPIO definitions
 #define MAIN_BUTTON_GPIO GPIO_NUM_4
 
-// Button timing definitions
-#define BUTTON_LONG_PRESS_TIME_MS 500
-#define BUTTON_DOUBLE_PRESS_TIME_MS 300
-
 // Button states
 typedef enum {
     BUTTON_IDLE,
@@ -24,19 +21,11 @@ typedef enum {
 typedef struct {
     gpio_num_t gpio_num;
     uint32_t long_press_time_ms;    // Time in ms to trigger long press
-    uint32_t double_press_time_ms;  // Maximum time between presses to count as double press
+    uint32_t double_press_time_ms;  // Maximum release between the clicks of a multi-click
     bool active_low;                // true if button is active low (pressed = 0)
 } button_config_t;
 
-// Button event types
-typedef enum {
-    BUTTON_EVENT_PRESSED,
-    BUTTON_EVENT_RELEASED,
-    BUTTON_EVENT_LONG_PRESS,
-    BUTTON_EVENT_DOUBLE_PRESS
-} button_event_t;
-
-// Callback function type
+// Callback function type, called from the esp_timer task
 typedef void (*button_callback_t)(button_event_t event, void* user_data);
 
 // Initialize button with configuration
@@ -51,7 +40,8 @@ button_state_t button_get_state(void);
 // Get current press duration in milliseconds
 uint32_t button_get_press_duration_ms(void);
 
-// Start button monitoring task
+// Enable the button interrupt. Idle costs no CPU time, and a press also
+// wakes the chip from light sleep.
 void button_start_monitoring(void);
 
 // Add after other function declarations
@@ -0,0 +1,66 @@
+#include "button_actions.h"
+
+// Screens cycled through with a double press
+static const ui_screen_t cycle_screens[] = { UI_SCREEN_HOME, UI_SCREEN_DETAILED };
+#define CYCLE_SCREEN_COUNT (sizeof(cycle_screens) / sizeof(cycle_screens[0]))
+
+void button_actions_gestures(button_gesture_t table[BUTTON_ACTIONS_GESTURE_COUNT], uint32_t long_press_ms) {
+    // Double and triple press wait out the click gap to tell them apart
+    table[0] = (button_gesture_t){ 1, 0, BUTTON_EVENT_CLICK };
+    table[1] = (button_gesture_t){ 2, 0, BUTTON_EVENT_DOUBLE_PRESS };
+    table[2] = (button_gesture_t){ 3, 0, BUTTON_EVENT_TRIPLE_PRESS };
+    table[3] = (button_gesture_t){ 0, long_press_ms, BUTTON_EVENT_LONG_PRESS };
+    table[4] = (button_gesture_t){ 1, long_press_ms, BUTTON_EVENT_CLICK_HOLD };
+}
+
+void button_actions_init(button_actions_t *st, ui_screen_t resume_screen) {
+    *st = (button_actions_t){0};
+    for (size_t i = 0; i < CYCLE_SCREEN_COUNT; i++) {
+        if (cycle_screens[i] == resume_screen) {
+            st->cycle_index = i;
+        }
+    }
+}
+
+static button_action_t load(ui_screen_t screen, button_riding_t riding) {
+    return (button_action_t){ .riding = riding, .load = true, .screen = screen };
+}
+
+// Out of riding mode onto the first screen of the cycle
+static button_action_t leave_riding(button_actions_t *st) {
+    st->cycle_index = 0;
+    st->diagnostics_shown = false;
+    return load(cycle_screens[0], BUTTON_RIDING_LEAVE);
+}
+
+button_action_t button_actions_handle(button_actions_t *st, button_event_t event, bool riding) {
+    switch (event) {
+        case BUTTON_EVENT_DOUBLE_PRESS:
+            // Cycle through the screens, back to the first after the last
+            if (riding) {
+                return leave_riding(st);
+            }
+            if (st->diagnostics_shown) {
+                // Back to where the cycle was
+                st->diagnostics_shown = false;
+            } else {
+                st->cycle_index = (st->cycle_index + 1) % CYCLE_SCREEN_COUNT;
+            }
+            return load(cycle_screens[st->cycle_index], BUTTON_RIDING_KEEP);
+        case BUTTON_EVENT_TRIPLE_PRESS:
+            // Straight into riding mode from any screen, or back out of it
+            if (riding) {
+                return leave_riding(st);
+            }
+            st->diagnostics_shown = false;
+            return (button_action_t){ .riding = BUTTON_RIDING_ENTER };
+        case BUTTON_EVENT_CLICK_HOLD:
+            // Runtime figures over whatever is shown, again to go back. From
+            // riding mode this lights the panel straight onto the figures.
+            st->diagnostics_shown = riding || !st->diagnostics_shown;
+            return load(st->diagnostics_shown ? UI_SCREEN_DIAGNOSTICS : cycle_screens[st->cycle_index],
+                        riding ? BUTTON_RIDING_LEAVE : BUTTON_RIDING_KEEP);
+        default:
+            return (button_action_t){ .riding = BUTTON_RIDING_KEEP };
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef BUTTON_ACTIONS_H
+#define BUTTON_ACTIONS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "button_gesture.h"
+#include "ui_screen.h"
+
+// The remote's gesture table and what each gesture does. It has no
+// hardware or RTOS dependencies: button.c recognises the gestures and
+// applies the actions, the UI simulator and the host tests run the same
+// table and dispatch.
+
+// Button timing definitions
+#define BUTTON_LONG_PRESS_TIME_MS 500
+#define BUTTON_DOUBLE_PRESS_TIME_MS 300
+
+#define BUTTON_ACTIONS_GESTURE_COUNT 5
+
+// Fill in the gesture table, for button_gesture_init() with the double
+// press time as its click gap
+void button_actions_gestures(button_gesture_t table[BUTTON_ACTIONS_GESTURE_COUNT], uint32_t long_press_ms);
+
+typedef enum {
+    BUTTON_RIDING_KEEP,
+    BUTTON_RIDING_ENTER,
+    BUTTON_RIDING_LEAVE
+} button_riding_t;
+
+// What a gesture asks for, the riding change first and then the screen
+typedef struct {
+    button_riding_t riding;
+    bool load;
+    ui_screen_t screen;
+} button_action_t;
+
+typedef struct {
+    size_t cycle_index;      // Screen of the double press cycle
+    bool diagnostics_shown;  // Over the cycle, until a click-hold or another gesture
+} button_actions_t;
+
+// Continue the cycle from resume_screen when it is part of it
+void button_actions_init(button_actions_t *st, ui_screen_t resume_screen);
+
+// Action for a recognised gesture, riding is whether riding mode is on.
+// Press, release and long press are left to their own handlers.
+button_action_t button_actions_handle(button_actions_t *st, button_event_t event, bool riding);
+
+#endif // BUTTON_ACTIONS_H
@@ -0,0 +1,103 @@
+#include "button_gesture.h"
+
+static bool is_hold(const button_gesture_t *row) {
+    return row->hold_ms > 0;
+}
+
+static uint32_t ms_left(uint32_t now, uint32_t since, uint32_t timeout) {
+    uint32_t elapsed = now - since;
+    return elapsed >= timeout ? 0 : timeout - elapsed;
+}
+
+void button_gesture_init(button_gesture_state_t *st, const button_gesture_t *table, size_t count,
+                         uint32_t click_gap_ms) {
+    *st = (button_gesture_state_t){0};
+    st->table = table;
+    st->count = count < BUTTON_GESTURE_MAX_ROWS ? count : BUTTON_GESTURE_MAX_ROWS;
+    st->click_gap_ms = click_gap_ms;
+
+    for (size_t i = 0; i < st->count; i++) {
+        if (!is_hold(&table[i]) && table[i].clicks > st->max_clicks) {
+            st->max_clicks = table[i].clicks;
+        }
+    }
+}
+
+// The click sequence is over, report it if the table knows that many clicks
+static void resolve_clicks(button_gesture_state_t *st, button_gesture_emit_t emit, void *ctx) {
+    for (size_t i = 0; i < st->count; i++) {
+        if (!is_hold(&st->table[i]) && st->table[i].clicks == st->clicks) {
+            emit(st->table[i].event, ctx);
+            break;
+        }
+    }
+    st->clicks = 0;
+}
+
+void button_gesture_edge(button_gesture_state_t *st, bool pressed, uint32_t now_ms,
+                         button_gesture_emit_t emit, void *ctx) {
+    if (pressed == st->pressed) {
+        return;
+    }
+
+    if (pressed) {
+        // A late tick must not merge this press into an expired sequence
+        button_gesture_tick(st, now_ms, emit, ctx);
+        st->pressed = true;
+        st->press_at = now_ms;
+        st->fired = 0;
+        emit(BUTTON_EVENT_PRESSED, ctx);
+        return;
+    }
+
+    button_gesture_tick(st, now_ms, emit, ctx);
+    st->pressed = false;
+    if (st->fired != 0) {
+        // A hold ends the sequence, the press was not a click
+        st->clicks = 0;
+    } else {
+        st->clicks++;
+        st->release_at = now_ms;
+        if (st->clicks >= st->max_clicks) {
+            resolve_clicks(st, emit, ctx);
+        }
+    }
+    emit(BUTTON_EVENT_RELEASED, ctx);
+}
+
+void button_gesture_tick(button_gesture_state_t *st, uint32_t now_ms, button_gesture_emit_t emit, void *ctx) {
+    if (!st->pressed) {
+        if (st->clicks > 0 && ms_left(now_ms, st->release_at, st->click_gap_ms) == 0) {
+            resolve_clicks(st, emit, ctx);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < st->count; i++) {
+        const button_gesture_t *row = &st->table[i];
+        uint32_t bit = 1UL << i;
+        if (is_hold(row) && row->clicks == st->clicks && !(st->fired & bit) &&
+            ms_left(now_ms, st->press_at, row->hold_ms) == 0) {
+            st->fired |= bit;
+            emit(row->event, ctx);
+        }
+    }
+}
+
+uint32_t button_gesture_next_ms(const button_gesture_state_t *st, uint32_t now_ms) {
+    if (!st->pressed) {
+        return st->clicks > 0 ? ms_left(now_ms, st->release_at, st->click_gap_ms) : UINT32_MAX;
+    }
+
+    uint32_t next = UINT32_MAX;
+    for (size_t i = 0; i < st->count; i++) {
+        const button_gesture_t *row = &st->table[i];
+        if (is_hold(row) && row->clicks == st->clicks && !(st->fired & (1UL << i))) {
+            uint32_t left = ms_left(now_ms, st->press_at, row->hold_ms);
+            if (left < next) {
+                next = left;
+            }
+        }
+    }
+    return next;
+}
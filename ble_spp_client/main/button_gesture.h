@@ -0,0 +1,63 @@
+#ifndef BUTTON_GESTURE_H
+#define BUTTON_GESTURE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Gesture recogniser for a single button. It has no hardware or RTOS
+// dependencies: it is fed debounced edges and the time, and tells the
+// driver when it next needs to be ticked.
+
+// Button event types
+typedef enum {
+    BUTTON_EVENT_PRESSED,
+    BUTTON_EVENT_RELEASED,
+    BUTTON_EVENT_LONG_PRESS,
+    BUTTON_EVENT_DOUBLE_PRESS,
+    BUTTON_EVENT_CLICK,
+    BUTTON_EVENT_TRIPLE_PRESS,
+    BUTTON_EVENT_CLICK_HOLD
+} button_event_t;
+
+// Hold rows are tracked in a bit mask
+#define BUTTON_GESTURE_MAX_ROWS 32
+
+// One row of the gesture table. With hold_ms 0 the row ends on the release
+// of the clicks-th short press, once no further press follows within the
+// click gap. Otherwise it fires while the press after `clicks` short presses
+// has been held for hold_ms, e.g. {0, 3000, ...} for a 3 s hold.
+typedef struct {
+    uint8_t clicks;
+    uint32_t hold_ms;
+    button_event_t event;
+} button_gesture_t;
+
+typedef void (*button_gesture_emit_t)(button_event_t event, void *ctx);
+
+typedef struct {
+    const button_gesture_t *table;
+    size_t count;
+    uint32_t click_gap_ms;  // Longest release between clicks of one gesture
+    uint8_t max_clicks;     // Nothing longer exists, resolved on release
+    bool pressed;
+    uint8_t clicks;         // Short presses so far in this sequence
+    uint32_t press_at;
+    uint32_t release_at;
+    uint32_t fired;         // Hold rows fired during this press
+} button_gesture_state_t;
+
+void button_gesture_init(button_gesture_state_t *st, const button_gesture_t *table, size_t count,
+                         uint32_t click_gap_ms);
+
+// Feed a debounced edge. Times are in ms and may wrap.
+void button_gesture_edge(button_gesture_state_t *st, bool pressed, uint32_t now_ms,
+                         button_gesture_emit_t emit, void *ctx);
+
+// Fire holds and click gestures that are due
+void button_gesture_tick(button_gesture_state_t *st, uint32_t now_ms, button_gesture_emit_t emit, void *ctx);
+
+// Time until the next tick is needed, UINT32_MAX when waiting for an edge
+uint32_t button_gesture_next_ms(const button_gesture_state_t *st, uint32_t now_ms);
+
+#endif // BUTTON_GESTURE_H
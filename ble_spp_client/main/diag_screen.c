@@ -0,0 +1,65 @@
+#include "diag_screen.h"
+#include <stdio.h>
+#include "diagnostics.h"
+#include "trip.h"
+
+lv_obj_t *diag_screen = NULL;
+
+static lv_obj_t *label;
+static lv_timer_t *refresh_timer;
+static char text[1024];     // Referenced by the label
+static diag_snapshot_t snapshot;  // Too big for the LVGL task stack
+
+static void refresh(lv_timer_t *timer) {
+    if (!diagnostics_get(&snapshot)) {
+        lv_label_set_text_static(label, "Sampling...");
+        return;
+    }
+
+    const diag_snapshot_t *s = &snapshot;
+    int len = snprintf(text, sizeof(text),
+                       "up %lus  %u fps  %u ms/frame\n"
+                       "notify->lcd %u ms (max %u)\n"
+                       "adc %u/s  tx %u/s  rx %u/s\n"
+                       "heap %luk (min %luk) dma %luk\n"
+                       "lvgl %lu / %lu\n"
+                       "trip %ld wh  range %ld km  odo %ld km\n"
+                       "task          cpu  stack\n",
+                       (unsigned long)s->uptime_s, s->fps, s->render_ms,
+                       s->notify_latency_ms, s->notify_latency_max_ms,
+                       s->rates[DIAG_ADC_SAMPLES], s->rates[DIAG_BLE_TX], s->rates[DIAG_BLE_RX],
+                       (unsigned long)s->heap_internal / 1024, (unsigned long)s->heap_internal_min / 1024,
+                       (unsigned long)s->heap_dma / 1024,
+                       (unsigned long)s->lvgl_used, (unsigned long)s->lvgl_total,
+                       (long)(trip_get_energy_dwh() / 10), (long)(trip_get_range_hm() / 10),
+                       (long)trip_get_odometer_km());
+
+    for (size_t i = 0; i < s->task_count && len > 0 && len < (int)sizeof(text); i++) {
+        len += snprintf(text + len, sizeof(text) - len, "%-13.13s %3u%% %5lu\n", s->tasks[i].name,
+                        s->tasks[i].cpu_pct, (unsigned long)s->tasks[i].stack_free);
+    }
+    lv_label_set_text_static(label, text);
+}
+
+static void screen_deleted(lv_event_t *e) {
+    lv_timer_del(refresh_timer);
+    refresh_timer = NULL;
+    label = NULL;
+    diagnostics_set_visible(false);
+}
+
+void diag_screen_init(void) {
+    diag_screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(diag_screen, lv_color_black(), 0);
+
+    label = lv_label_create(diag_screen);
+    lv_obj_set_width(label, LV_PCT(100));
+    lv_obj_set_style_text_color(label, lv_color_white(), 0);
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_14, 0);
+    lv_obj_align(label, LV_ALIGN_TOP_LEFT, 0, 0);
+
+    diagnostics_set_visible(true);
+    refresh_timer = lv_timer_create(refresh, DIAGNOSTICS_PERIOD_MS, NULL);
+    lv_obj_add_event_cb(diag_screen, screen_deleted, LV_EVENT_DELETE, NULL);
+    refresh(refresh_timer);
+}
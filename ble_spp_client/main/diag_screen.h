@@ -0,0 +1,13 @@
+#ifndef DIAG_SCREEN_H
+#define DIAG_SCREEN_H
+
+#include "lvgl.h"
+
+// Live runtime figures from the diagnostics module, refreshed every
+// DIAGNOSTICS_PERIOD_MS. Built by the screen manager like the SquareLine
+// screens, sampling runs only while it exists.
+extern lv_obj_t *diag_screen;
+
+void diag_screen_init(void);
+
+#endif // DIAG_SCREEN_H
@@ -0,0 +1,287 @@
+#include "diagnostics.h"
+#include <stdio.h>
+#include <string.h>
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lvgl.h"
+#include "display_power.h"
+#include "executor.h"
+
+#define TAG "DIAG"
+
+static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Written by the hooks under lock, taken and cleared by the sampler
+static uint32_t counters[DIAG_COUNTER_MAX];
+static uint32_t frames;
+static uint32_t render_ms_sum;
+static int64_t notify_pending_us;  // Arrived, not on the widgets yet
+static int64_t notify_applied_us;  // On the widgets, not flushed yet
+static uint32_t latency_ms_sum;
+static uint32_t latency_count;
+static uint32_t latency_ms_max;
+
+// LVGL heap, only readable from the LVGL task. The sampler asks for it and
+// the next frame fills it in.
+static volatile bool lvgl_sample_due;
+static uint32_t lvgl_used;
+static uint32_t lvgl_total;
+
+static volatile bool visible;
+
+// Sampler state, background worker only
+static TaskStatus_t task_status[DIAGNOSTICS_MAX_TASKS];
+static TaskHandle_t prev_handles[DIAGNOSTICS_MAX_TASKS];
+static uint32_t prev_runtimes[DIAGNOSTICS_MAX_TASKS];
+static size_t prev_count;
+static uint32_t prev_total_runtime;
+static int64_t prev_sample_us;
+static bool have_baseline;
+static diag_snapshot_t work;
+
+static SemaphoreHandle_t snapshot_mutex = NULL;
+static diag_snapshot_t latest;
+static bool have_latest;
+
+#if DIAGNOSTICS_UART_DUMP
+static char dump_buf[1536];
+#endif
+
+static uint32_t prev_runtime_of(TaskHandle_t handle, bool *found) {
+    for (size_t i = 0; i < prev_count; i++) {
+        if (prev_handles[i] == handle) {
+            *found = true;
+            return prev_runtimes[i];
+        }
+    }
+    *found = false;
+    return 0;
+}
+
+static void sample_tasks(uint32_t total_runtime, size_t count) {
+    uint32_t total_delta = total_runtime - prev_total_runtime;
+
+    work.task_count = count;
+    for (size_t i = 0; i < count; i++) {
+        const TaskStatus_t *t = &task_status[i];
+        diag_task_t *out = &work.tasks[i];
+        bool found;
+        uint32_t prev = prev_runtime_of(t->xHandle, &found);
+
+        snprintf(out->name, sizeof(out->name), "%s", t->pcTaskName);
+        // ESP-IDF counts the stack in bytes
+        out->stack_free = t->usStackHighWaterMark;
+        out->cpu_pct = 0;
+        if (found && total_delta > 0) {
+            uint64_t pct = (uint64_t)(t->ulRunTimeCounter - prev) * 100 / total_delta;
+            out->cpu_pct = pct > 100 ? 100 : (uint8_t)pct;
+        }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        prev_handles[i] = task_status[i].xHandle;
+        prev_runtimes[i] = task_status[i].ulRunTimeCounter;
+    }
+    prev_count = count;
+    prev_total_runtime = total_runtime;
+}
+
+#if DIAGNOSTICS_UART_DUMP
+static void dump_snapshot(const diag_snapshot_t *s) {
+    int len = snprintf(dump_buf, sizeof(dump_buf),
+                       "{\"up\":%lu,\"fps\":%u,\"render_ms\":%u,\"lat_ms\":%u,\"lat_max_ms\":%u,"
+                       "\"adc_hz\":%u,\"tx_hz\":%u,\"rx_hz\":%u,"
+                       "\"heap\":%lu,\"heap_min\":%lu,\"dma\":%lu,\"lvgl\":%lu,\"lvgl_total\":%lu,\"tasks\":[",
+                       (unsigned long)s->uptime_s, s->fps, s->render_ms, s->notify_latency_ms,
+                       s->notify_latency_max_ms, s->rates[DIAG_ADC_SAMPLES], s->rates[DIAG_BLE_TX],
+                       s->rates[DIAG_BLE_RX], (unsigned long)s->heap_internal, (unsigned long)s->heap_internal_min,
+                       (unsigned long)s->heap_dma, (unsigned long)s->lvgl_used, (unsigned long)s->lvgl_total);
+
+    for (size_t i = 0; i < s->task_count && len > 0 && len < (int)sizeof(dump_buf); i++) {
+        len += snprintf(dump_buf + len, sizeof(dump_buf) - len, "%s{\"name\":\"%s\",\"cpu\":%u,\"stack\":%lu}",
+                        i > 0 ? "," : "", s->tasks[i].name, s->tasks[i].cpu_pct,
+                        (unsigned long)s->tasks[i].stack_free);
+    }
+    if (len <= 0 || len >= (int)sizeof(dump_buf) - 2) {
+        ESP_LOGW(TAG, "Snapshot does not fit the dump buffer");
+        return;
+    }
+    strcpy(dump_buf + len, "]}");
+    printf(DIAGNOSTICS_UART_PREFIX "%s\n", dump_buf);
+}
+#endif
+
+static void sample(void *arg) {
+    if ((!visible || display_power_is_off()) && !DIAGNOSTICS_UART_DUMP) {
+        // Nobody looks, the next sample starts a fresh period
+        have_baseline = false;
+        return;
+    }
+
+    int64_t now_us = esp_timer_get_time();
+    uint32_t total_runtime;
+    size_t count = uxTaskGetSystemState(task_status, DIAGNOSTICS_MAX_TASKS, &total_runtime);
+    if (count == 0) {
+        ESP_LOGW(TAG, "More than %d tasks, raise DIAGNOSTICS_MAX_TASKS", DIAGNOSTICS_MAX_TASKS);
+    }
+
+    uint32_t counts[DIAG_COUNTER_MAX];
+    taskENTER_CRITICAL(&lock);
+    memcpy(counts, counters, sizeof(counts));
+    memset(counters, 0, sizeof(counters));
+    uint32_t frame_count = frames;
+    uint32_t render_sum = render_ms_sum;
+    uint32_t lat_sum = latency_ms_sum;
+    uint32_t lat_count = latency_count;
+    uint32_t lat_max = latency_ms_max;
+    frames = 0;
+    render_ms_sum = 0;
+    latency_ms_sum = 0;
+    latency_count = 0;
+    latency_ms_max = 0;
+    uint32_t lv_used = lvgl_used;
+    uint32_t lv_total = lvgl_total;
+    taskEXIT_CRITICAL(&lock);
+    lvgl_sample_due = true;
+
+    if (!have_baseline) {
+        // Counters and run times so far cover an unknown span
+        sample_tasks(total_runtime, count);
+        prev_sample_us = now_us;
+        have_baseline = true;
+        return;
+    }
+
+    uint32_t elapsed_ms = (uint32_t)((now_us - prev_sample_us) / 1000);
+    prev_sample_us = now_us;
+    if (elapsed_ms == 0) {
+        elapsed_ms = 1;
+    }
+
+    work.uptime_s = (uint32_t)(now_us / 1000000);
+    sample_tasks(total_runtime, count);
+    work.heap_internal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    work.heap_internal_min = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    work.heap_dma = heap_caps_get_free_size(MALLOC_CAP_DMA);
+    work.lvgl_used = lv_used;
+    work.lvgl_total = lv_total;
+    work.fps = (uint16_t)((frame_count * 1000 + elapsed_ms / 2) / elapsed_ms);
+    work.render_ms = frame_count > 0 ? (uint16_t)(render_sum / frame_count) : 0;
+    for (size_t i = 0; i < DIAG_COUNTER_MAX; i++) {
+        work.rates[i] = (uint16_t)(((uint64_t)counts[i] * 1000 + elapsed_ms / 2) / elapsed_ms);
+    }
+    work.notify_latency_ms = lat_count > 0 ? (uint16_t)(lat_sum / lat_count) : 0;
+    work.notify_latency_max_ms = (uint16_t)lat_max;
+
+    xSemaphoreTake(snapshot_mutex, portMAX_DELAY);
+    latest = work;
+    have_latest = true;
+    xSemaphoreGive(snapshot_mutex);
+
+#if DIAGNOSTICS_UART_DUMP
+    dump_snapshot(&work);
+#endif
+}
+
+void diagnostics_init(void) {
+    if (snapshot_mutex != NULL) {
+        return;
+    }
+    snapshot_mutex = xSemaphoreCreateMutex();
+    if (snapshot_mutex == NULL) {
+        ESP_LOGE(TAG, "No memory for the snapshot mutex");
+        return;
+    }
+    if (executor_every(EXECUTOR_BACKGROUND, DIAGNOSTICS_PERIOD_MS, sample, NULL) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to schedule the sampler");
+    }
+}
+
+void diagnostics_set_visible(bool shown) {
+    visible = shown;
+}
+
+bool diagnostics_get(diag_snapshot_t *out) {
+    bool ok = false;
+
+    if (snapshot_mutex == NULL) {
+        return false;
+    }
+    xSemaphoreTake(snapshot_mutex, portMAX_DELAY);
+    if (have_latest) {
+        *out = latest;
+        ok = true;
+    }
+    xSemaphoreGive(snapshot_mutex);
+    return ok;
+}
+
+void diagnostics_count(diag_counter_t counter) {
+    if (counter >= DIAG_COUNTER_MAX) {
+        return;
+    }
+    taskENTER_CRITICAL(&lock);
+    counters[counter]++;
+    taskEXIT_CRITICAL(&lock);
+}
+
+void diagnostics_notify_received(void) {
+    // Nothing gets drawn while the panel sleeps
+    if (display_power_is_off()) {
+        return;
+    }
+    int64_t now_us = esp_timer_get_time();
+
+    // Later notifications in the same pass are drawn sooner, the first one
+    // is the worst case
+    taskENTER_CRITICAL(&lock);
+    if (notify_pending_us == 0) {
+        notify_pending_us = now_us;
+    }
+    taskEXIT_CRITICAL(&lock);
+}
+
+void diagnostics_bindings_refreshed(void) {
+    // Widgets are updated while the panel sleeps, the frame comes at wake up
+    bool off = display_power_is_off();
+
+    taskENTER_CRITICAL(&lock);
+    if (off) {
+        notify_pending_us = 0;
+    } else if (notify_pending_us != 0 && notify_applied_us == 0) {
+        notify_applied_us = notify_pending_us;
+        notify_pending_us = 0;
+    }
+    taskEXIT_CRITICAL(&lock);
+}
+
+void diagnostics_frame_rendered(uint32_t render_ms) {
+    int64_t now_us = esp_timer_get_time();
+
+    if (lvgl_sample_due) {
+        lvgl_sample_due = false;
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        taskENTER_CRITICAL(&lock);
+        lvgl_used = mon.total_size - mon.free_size;
+        lvgl_total = mon.total_size;
+        taskEXIT_CRITICAL(&lock);
+    }
+
+    taskENTER_CRITICAL(&lock);
+    frames++;
+    render_ms_sum += render_ms;
+    if (notify_applied_us != 0) {
+        uint32_t latency_ms = (uint32_t)((now_us - notify_applied_us) / 1000);
+        notify_applied_us = 0;
+        latency_ms_sum += latency_ms;
+        latency_count++;
+        if (latency_ms > latency_ms_max) {
+            latency_ms_max = latency_ms;
+        }
+    }
+    taskEXIT_CRITICAL(&lock);
+}
@@ -0,0 +1,68 @@
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+
+// How often a snapshot is taken while the diagnostics screen is shown or
+// the UART dump is on
+#define DIAGNOSTICS_PERIOD_MS 1000
+
+// Set to 1 to print every snapshot as one JSON line, prefixed with
+// DIAGNOSTICS_UART_PREFIX so a host logger can pick it out of the console
+#define DIAGNOSTICS_UART_DUMP 0
+#define DIAGNOSTICS_UART_PREFIX "DIAG "
+
+// Tasks beyond this are left out of a snapshot
+#define DIAGNOSTICS_MAX_TASKS 20
+
+typedef enum {
+    DIAG_ADC_SAMPLES,
+    DIAG_BLE_TX,
+    DIAG_BLE_RX,
+    DIAG_COUNTER_MAX
+} diag_counter_t;
+
+typedef struct {
+    char name[configMAX_TASK_NAME_LEN];
+    uint8_t cpu_pct;         // Share of the last period
+    uint32_t stack_free;     // Smallest free stack seen, in bytes
+} diag_task_t;
+
+typedef struct {
+    uint32_t uptime_s;
+    diag_task_t tasks[DIAGNOSTICS_MAX_TASKS];
+    size_t task_count;
+    uint32_t heap_internal;  // Free bytes
+    uint32_t heap_internal_min;
+    uint32_t heap_dma;
+    uint32_t lvgl_used;
+    uint32_t lvgl_total;
+    uint16_t fps;
+    uint16_t render_ms;      // Average per frame, includes the flush
+    uint16_t rates[DIAG_COUNTER_MAX];  // Per second
+    uint16_t notify_latency_ms;        // Average notify to flushed frame
+    uint16_t notify_latency_max_ms;
+} diag_snapshot_t;
+
+// Schedule the sampler on the background worker
+void diagnostics_init(void);
+
+// Sample only while someone looks. LVGL task.
+void diagnostics_set_visible(bool visible);
+
+// Copy of the latest snapshot, false if there is none yet
+bool diagnostics_get(diag_snapshot_t *out);
+
+// Event counters, any task
+void diagnostics_count(diag_counter_t counter);
+
+// Notify to display latency: a notification arrived (BLE task), its values
+// were pushed to the widgets and a frame was flushed (both LVGL task)
+void diagnostics_notify_received(void);
+void diagnostics_bindings_refreshed(void);
+void diagnostics_frame_rendered(uint32_t render_ms);
+
+#endif // DIAGNOSTICS_H
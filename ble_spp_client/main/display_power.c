@@ -0,0 +1,351 @@
+#include "display_power.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/ledc.h"
+#include "esp_log.h"
+#include "esp_rom_sys.h"
+#include "button.h"
+#include "lcd.h"
+#include "adc.h"
+#include "ble_spp_client.h"
+#include "ui_cmd.h"
+#include "sim_hw.h"
+
+#define TAG "DISPLAY_POWER"
+
+#define BL_MODE LEDC_LOW_SPEED_MODE
+#define BL_TIMER LEDC_TIMER_0
+#define BL_CHANNEL LEDC_CHANNEL_0
+
+// ST7789 wants 5 ms after sleep out before the next command
+#define PANEL_SLEEP_OUT_US 5000
+
+typedef enum {
+    RIDING_NO_REQUEST,
+    RIDING_REQUEST_ON,
+    RIDING_REQUEST_OFF
+} riding_request_t;
+
+static esp_lcd_panel_handle_t panel_handle;
+static volatile display_power_state_t state = DISPLAY_POWER_ON;
+static bool backlight_started = false;
+static TickType_t off_at;
+static volatile TickType_t last_activity;
+static volatile TickType_t last_press;
+static volatile bool activity_pending = false;
+
+// Owned by the LVGL task, other tasks go through riding_request
+static volatile bool riding = false;
+static volatile riding_request_t riding_request = RIDING_NO_REQUEST;
+static volatile bool alert_pending = false;
+static bool alert_active = false;
+static TickType_t alert_until;
+static bool was_connected = false;
+static TickType_t connected_at;
+
+#if DISPLAY_POWER_STATS
+static TickType_t riding_start;
+static int32_t riding_start_battery;
+#endif
+
+static void fade_to(uint32_t duty, int time_ms, ledc_fade_mode_t mode) {
+    // Dark until the first frame is on the panel, display_power_frame_shown()
+    // then lights it to the level of the state
+    if (!backlight_started) {
+        return;
+    }
+#if SIM_HW
+    sim_hw_backlight(duty);
+#else
+    // A new fade replaces one that is still running
+    esp_err_t ret = ledc_set_fade_time_and_start(BL_MODE, BL_CHANNEL, duty, time_ms, mode);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Backlight fade failed: %s", esp_err_to_name(ret));
+    }
+#endif
+}
+
+static void button_activity_cb(button_event_t event, void *user_data) {
+    switch (event) {
+        case BUTTON_EVENT_PRESSED:
+            last_press = xTaskGetTickCount();
+            display_power_activity();
+            break;
+        case BUTTON_EVENT_LONG_PRESS:
+            // The shutdown screen has to be visible
+            display_power_set_riding(false);
+            break;
+        default:
+            break;
+    }
+}
+
+esp_err_t display_power_init(esp_lcd_panel_handle_t panel) {
+    panel_handle = panel;
+
+#if !SIM_HW
+    ledc_timer_config_t timer_config = {
+        .speed_mode = BL_MODE,
+        .duty_resolution = LEDC_TIMER_10_BIT,
+        .timer_num = BL_TIMER,
+        .freq_hz = DISPLAY_PWM_FREQ_HZ,
+        // The APB clock changes with frequency scaling and stops in light
+        // sleep, RC_FAST keeps the PWM steady through both
+        .clk_cfg = LEDC_USE_RC_FAST_CLK,
+    };
+    ledc_channel_config_t channel_config = {
+        .gpio_num = TFT_BL_PIN,
+        .speed_mode = BL_MODE,
+        .channel = BL_CHANNEL,
+        .timer_sel = BL_TIMER,
+        .duty = 0,
+        .hpoint = 0,
+    };
+    esp_err_t ret;
+
+    ret = ledc_timer_config(&timer_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Backlight timer configuration failed");
+        return ret;
+    }
+    ret = ledc_channel_config(&channel_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Backlight channel configuration failed");
+        return ret;
+    }
+    ret = ledc_fade_func_install(0);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Backlight fade installation failed");
+        return ret;
+    }
+#endif
+
+    button_register_callback(button_activity_cb, NULL);
+    last_activity = xTaskGetTickCount();
+    last_press = last_activity;
+    return ESP_OK;
+}
+
+void display_power_activity(void) {
+    last_activity = xTaskGetTickCount();
+
+    // Riding mode ignores the throttle, and the LVGL task stays asleep
+    if (riding) {
+        return;
+    }
+    activity_pending = true;
+
+    // While fully on the new timestamp is picked up on the next pass anyway
+    if (state != DISPLAY_POWER_ON) {
+        lcd_wake();
+    }
+}
+
+void display_power_set_riding(bool on) {
+    riding_request = on ? RIDING_REQUEST_ON : RIDING_REQUEST_OFF;
+    lcd_wake();
+}
+
+bool display_power_is_riding(void) {
+    return riding;
+}
+
+void display_power_alert(void) {
+    alert_pending = true;
+    lcd_wake();
+}
+
+// Returns true if the panel was asleep, it then needs a render pass right away
+static bool wake(void) {
+    bool was_off = state == DISPLAY_POWER_OFF;
+
+    if (was_off) {
+        // Frame memory survives sleep in, the last frame is shown right away
+#if !SIM_HW
+        esp_lcd_panel_disp_sleep(panel_handle, false);
+        esp_rom_delay_us(PANEL_SLEEP_OUT_US);
+#endif
+        ESP_LOGI(TAG, "Display on");
+
+        // Telemetry refreshes are dropped while the panel is off
+        ui_cmd_simple(UI_CMD_REFRESH_BINDINGS);
+    }
+    fade_to(DISPLAY_BRIGHTNESS_ON, DISPLAY_FADE_UP_MS, LEDC_FADE_NO_WAIT);
+    state = DISPLAY_POWER_ON;
+    return was_off;
+}
+
+static void panel_off(TickType_t now) {
+    // The ramp runs in hardware, the panel sleeps once it is dark
+    fade_to(0, DISPLAY_FADE_OFF_MS, LEDC_FADE_NO_WAIT);
+    off_at = now + pdMS_TO_TICKS(DISPLAY_FADE_OFF_MS);
+    state = DISPLAY_POWER_FADING_OFF;
+}
+
+// Finish panel_off() when the ramp is done. Returns the time in ms until
+// then, UINT32_MAX once the panel sleeps.
+static uint32_t panel_off_step(TickType_t now) {
+    int32_t left = (int32_t)(off_at - now);
+    if (left > 0) {
+        return left * portTICK_PERIOD_MS;
+    }
+#if !SIM_HW
+    esp_lcd_panel_disp_sleep(panel_handle, true);
+#endif
+    state = DISPLAY_POWER_OFF;
+    return UINT32_MAX;
+}
+
+static void set_riding(bool on) {
+    if (on == riding) {
+        return;
+    }
+    riding = on;
+    ESP_LOGI(TAG, "Riding mode %s", on ? "on" : "off");
+
+#if DISPLAY_POWER_STATS
+    TickType_t now = xTaskGetTickCount();
+    int32_t battery = adc_get_battery_percent();
+    if (on) {
+        riding_start = now;
+        riding_start_battery = battery;
+    } else {
+        ESP_LOGI(TAG, "Riding mode lasted %lu s, controller battery %ld%% -> %ld%%",
+                 (unsigned long)((now - riding_start) * portTICK_PERIOD_MS / 1000),
+                 (long)riding_start_battery, (long)battery);
+    }
+#endif
+
+    if (!on) {
+        // Back to normal mode with the panel on, and a full timeout before
+        // riding mode starts again on its own
+        last_activity = xTaskGetTickCount();
+        last_press = last_activity;
+        activity_pending = true;
+        alert_active = false;
+    }
+}
+
+static uint32_t ms_until(TickType_t now, TickType_t since, uint32_t timeout_ms) {
+    uint32_t elapsed_ms = (now - since) * portTICK_PERIOD_MS;
+    return elapsed_ms >= timeout_ms ? 0 : timeout_ms - elapsed_ms;
+}
+
+static bool requests_pending(void) {
+    return activity_pending || alert_pending || riding_request != RIDING_NO_REQUEST;
+}
+
+// Panel stays off, only alerts light it for a moment
+static uint32_t update_riding(TickType_t now) {
+    activity_pending = false;
+    if (alert_pending) {
+        alert_pending = false;
+        alert_active = true;
+        alert_until = now + pdMS_TO_TICKS(DISPLAY_ALERT_MS);
+    }
+
+    if (alert_active && (int32_t)(alert_until - now) > 0) {
+        if (state != DISPLAY_POWER_ON && wake()) {
+            return 0;
+        }
+        return (alert_until - now) * portTICK_PERIOD_MS;
+    }
+
+    alert_active = false;
+    if (state == DISPLAY_POWER_ON || state == DISPLAY_POWER_DIM) {
+        panel_off(now);
+    }
+    uint32_t next_ms = state == DISPLAY_POWER_FADING_OFF ? panel_off_step(now) : UINT32_MAX;
+    return requests_pending() ? 0 : next_ms;
+}
+
+void display_power_frame_shown(void) {
+    if (backlight_started) {
+        return;
+    }
+    backlight_started = true;
+
+    // No garbage is shown. A panel already fading out or asleep stays dark.
+    if (state == DISPLAY_POWER_ON) {
+        fade_to(DISPLAY_BRIGHTNESS_ON, DISPLAY_FADE_UP_MS, LEDC_FADE_NO_WAIT);
+    } else if (state == DISPLAY_POWER_DIM) {
+        fade_to(DISPLAY_BRIGHTNESS_DIM, DISPLAY_FADE_UP_MS, LEDC_FADE_NO_WAIT);
+    }
+}
+
+uint32_t display_power_update(void) {
+    riding_request_t request = riding_request;
+    if (request != RIDING_NO_REQUEST) {
+        riding_request = RIDING_NO_REQUEST;
+        set_riding(request == RIDING_REQUEST_ON);
+    }
+
+    // Riding is a connected state, a ride without buttons starts it. The
+    // timeout counts from the last press or the connection, whichever is later.
+    TickType_t press = last_press;
+    TickType_t now = xTaskGetTickCount();
+    if (is_connect && !was_connected) {
+        connected_at = now;
+    }
+    was_connected = is_connect;
+    if ((int32_t)(press - connected_at) < 0) {
+        press = connected_at;
+    }
+    if (!riding && is_connect && ms_until(now, press, DISPLAY_RIDING_TIMEOUT_MS) == 0) {
+        set_riding(true);
+    }
+    if (riding) {
+        return update_riding(now);
+    }
+
+    // Outside riding mode an alert is just activity
+    if (alert_pending) {
+        alert_pending = false;
+        display_power_activity();
+    }
+
+    if (activity_pending) {
+        activity_pending = false;
+        if (state != DISPLAY_POWER_ON && wake()) {
+            // Render what changed while the panel was off
+            return 0;
+        }
+    }
+
+    // Read in this order so an update in between cannot make now < last
+    TickType_t last = last_activity;
+    now = xTaskGetTickCount();
+    uint32_t idle_ms = (now - last) * portTICK_PERIOD_MS;
+    if (state == DISPLAY_POWER_ON && idle_ms >= DISPLAY_DIM_TIMEOUT_MS) {
+        fade_to(DISPLAY_BRIGHTNESS_DIM, DISPLAY_FADE_DIM_MS, LEDC_FADE_NO_WAIT);
+        state = DISPLAY_POWER_DIM;
+    }
+    if (state == DISPLAY_POWER_DIM && idle_ms >= DISPLAY_OFF_TIMEOUT_MS) {
+        panel_off(now);
+        ESP_LOGI(TAG, "Display off after %lu ms idle", (unsigned long)idle_ms);
+    }
+    uint32_t fade_ms = state == DISPLAY_POWER_FADING_OFF ? panel_off_step(now) : UINT32_MAX;
+
+    // Activity that raced with a transition above must not wait for the next timeout
+    if (requests_pending()) {
+        return 0;
+    }
+
+    uint32_t next_ms = fade_ms;
+    if (state == DISPLAY_POWER_ON) {
+        next_ms = ms_until(now, last, DISPLAY_DIM_TIMEOUT_MS);
+    } else if (state == DISPLAY_POWER_DIM) {
+        next_ms = ms_until(now, last, DISPLAY_OFF_TIMEOUT_MS);
+    }
+    if (is_connect) {
+        uint32_t riding_ms = ms_until(now, press, DISPLAY_RIDING_TIMEOUT_MS);
+        if (riding_ms < next_ms) {
+            next_ms = riding_ms;
+        }
+    }
+    return next_ms;
+}
+
+bool display_power_is_off(void) {
+    return state == DISPLAY_POWER_OFF;
+}
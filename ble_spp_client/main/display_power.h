@@ -0,0 +1,67 @@
+#ifndef DISPLAY_POWER_H
+#define DISPLAY_POWER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_panel_ops.h"
+
+// Backlight PWM, 5 kHz is above audible and visible flicker
+#define DISPLAY_PWM_FREQ_HZ 5000
+
+// Brightness levels in 10 bit duty steps
+#define DISPLAY_BRIGHTNESS_ON 1023
+#define DISPLAY_BRIGHTNESS_DIM 100
+
+// Idle time before dimming and before the panel goes to sleep
+#define DISPLAY_DIM_TIMEOUT_MS 15000
+#define DISPLAY_OFF_TIMEOUT_MS 45000
+
+// Backlight ramp durations
+#define DISPLAY_FADE_UP_MS 150
+#define DISPLAY_FADE_DIM_MS 1000
+#define DISPLAY_FADE_OFF_MS 500
+
+// Riding mode keeps the panel off and ignores the throttle. It starts after
+// this long connected without a button press, or from the screen cycle.
+#define DISPLAY_RIDING_TIMEOUT_MS 60000
+
+// How long an alert lights the panel in riding mode
+#define DISPLAY_ALERT_MS 5000
+
+// Set to 1 to log time and controller battery drain per riding mode session
+#define DISPLAY_POWER_STATS 0
+
+typedef enum {
+    DISPLAY_POWER_ON,
+    DISPLAY_POWER_DIM,
+    DISPLAY_POWER_FADING_OFF,  // Backlight ramping down, the panel still awake
+    DISPLAY_POWER_OFF
+} display_power_state_t;
+
+// Set up the backlight PWM, off until the first frame is rendered
+esp_err_t display_power_init(esp_lcd_panel_handle_t panel);
+
+// Note user activity (button, throttle). Any task, wakes the LVGL task
+// unless the display is fully on or in riding mode.
+void display_power_activity(void);
+
+// Enter or leave riding mode. Any task.
+void display_power_set_riding(bool riding);
+bool display_power_is_riding(void);
+
+// Light the panel for DISPLAY_ALERT_MS, also in riding mode. Any task.
+void display_power_alert(void);
+
+// A frame is on the panel, the first one lights the backlight. LVGL task
+// only, from the display driver's monitor callback.
+void display_power_frame_shown(void);
+
+// Step the dim/off state machine. LVGL task only, since it owns the panel.
+// Returns the time in ms until the next step is due, UINT32_MAX for none.
+uint32_t display_power_update(void);
+
+// True while the panel sleeps and LVGL must not render
+bool display_power_is_off(void);
+
+#endif // DISPLAY_POWER_H
@@ -0,0 +1,227 @@
+#include "executor.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+
+#define TAG "EXECUTOR"
+
+typedef struct {
+    executor_fn_t fn;  // NULL only wakes the worker
+    void *arg;
+} work_item_t;
+
+typedef struct {
+    executor_fn_t fn;
+    void *arg;
+    TickType_t period;
+    TickType_t next_run;
+} timer_slot_t;
+
+typedef struct {
+    QueueHandle_t queue;
+    executor_fn_t fn;
+    void *arg;
+} source_slot_t;
+
+typedef struct {
+    const char *name;
+    UBaseType_t priority;
+    TaskHandle_t task;
+    QueueHandle_t queue;
+    QueueSetHandle_t set;
+    portMUX_TYPE lock;  // Timer and source slots, added from other tasks
+    timer_slot_t timers[EXECUTOR_MAX_TIMERS];
+    size_t timer_count;
+    source_slot_t sources[EXECUTOR_MAX_SOURCES];
+    size_t source_count;
+    UBaseType_t source_events;
+} worker_t;
+
+static worker_t workers[EXECUTOR_WORKER_COUNT] = {
+    [EXECUTOR_CONTROL] = { .name = "exec_control", .priority = EXECUTOR_CONTROL_PRIORITY,
+                           .lock = portMUX_INITIALIZER_UNLOCKED },
+    [EXECUTOR_BACKGROUND] = { .name = "exec_background", .priority = EXECUTOR_BACKGROUND_PRIORITY,
+                              .lock = portMUX_INITIALIZER_UNLOCKED },
+};
+
+// Timers run on multiples of their period, so periods that divide each
+// other share wake-ups and leave the idle time in one piece for light sleep
+static TickType_t next_on_grid(TickType_t now, TickType_t period) {
+    return now - now % period + period;
+}
+
+// Runs the timers that are due, returns the ticks until the next one
+static TickType_t run_timers(worker_t *w) {
+    TickType_t wait = portMAX_DELAY;
+
+    for (size_t i = 0; i < EXECUTOR_MAX_TIMERS; i++) {
+        taskENTER_CRITICAL(&w->lock);
+        bool used = i < w->timer_count;
+        timer_slot_t timer = w->timers[i];
+        taskEXIT_CRITICAL(&w->lock);
+        if (!used) {
+            break;
+        }
+
+        TickType_t now = xTaskGetTickCount();
+        if ((int32_t)(timer.next_run - now) <= 0) {
+            timer.fn(timer.arg);
+            now = xTaskGetTickCount();
+            timer.next_run += timer.period;
+            if ((int32_t)(timer.next_run - now) <= 0) {
+                timer.next_run = next_on_grid(now, timer.period);
+            }
+            w->timers[i].next_run = timer.next_run;
+        }
+
+        TickType_t left = timer.next_run - now;
+        if (left < wait) {
+            wait = left;
+        }
+    }
+    return wait;
+}
+
+static void run_member(worker_t *w, QueueSetMemberHandle_t member) {
+    if (member == w->queue) {
+        work_item_t item;
+        if (xQueueReceive(w->queue, &item, 0) == pdTRUE && item.fn != NULL) {
+            item.fn(item.arg);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < w->source_count; i++) {
+        if (w->sources[i].queue == member) {
+            w->sources[i].fn(w->sources[i].arg);
+            return;
+        }
+    }
+}
+
+static void worker_task(void *param) {
+    worker_t *w = param;
+
+    while (1) {
+        TickType_t wait = run_timers(w);
+        QueueSetMemberHandle_t member = xQueueSelectFromSet(w->set, wait);
+        if (member != NULL) {
+            run_member(w, member);
+        }
+    }
+}
+
+#if EXECUTOR_STATS
+static void log_stats(void *arg) {
+    for (size_t i = 0; i < EXECUTOR_WORKER_COUNT; i++) {
+        ESP_LOGI(TAG, "%s: %lu of %d bytes stack unused", workers[i].name,
+                 (unsigned long)uxTaskGetStackHighWaterMark(workers[i].task), EXECUTOR_STACK_SIZE);
+    }
+}
+#endif
+
+esp_err_t executor_init(void) {
+    for (size_t i = 0; i < EXECUTOR_WORKER_COUNT; i++) {
+        worker_t *w = &workers[i];
+        if (w->task != NULL) {
+            continue;
+        }
+
+        // The set holds one entry per item in any of its member queues
+        w->queue = xQueueCreate(EXECUTOR_QUEUE_LENGTH, sizeof(work_item_t));
+        w->set = xQueueCreateSet(EXECUTOR_QUEUE_LENGTH + EXECUTOR_SOURCE_EVENTS);
+        if (w->queue == NULL || w->set == NULL || xQueueAddToSet(w->queue, w->set) != pdPASS) {
+            ESP_LOGE(TAG, "No memory for %s", w->name);
+            return ESP_ERR_NO_MEM;
+        }
+        if (xTaskCreate(worker_task, w->name, EXECUTOR_STACK_SIZE, w, w->priority, &w->task) != pdPASS) {
+            ESP_LOGE(TAG, "Failed to start %s", w->name);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+#if EXECUTOR_STATS
+    executor_every(EXECUTOR_BACKGROUND, 10000, log_stats, NULL);
+#endif
+    return ESP_OK;
+}
+
+esp_err_t executor_post(executor_worker_t worker, executor_fn_t fn, void *arg) {
+    work_item_t item = { .fn = fn, .arg = arg };
+
+    if (worker >= EXECUTOR_WORKER_COUNT || workers[worker].queue == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (xQueueSend(workers[worker].queue, &item, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "%s queue full", workers[worker].name);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t executor_every(executor_worker_t worker, uint32_t period_ms, executor_fn_t fn, void *arg) {
+    TickType_t period = pdMS_TO_TICKS(period_ms);
+    esp_err_t ret = ESP_OK;
+
+    if (worker >= EXECUTOR_WORKER_COUNT || fn == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (period == 0) {
+        period = 1;
+    }
+
+    worker_t *w = &workers[worker];
+    taskENTER_CRITICAL(&w->lock);
+    if (w->timer_count < EXECUTOR_MAX_TIMERS) {
+        w->timers[w->timer_count] = (timer_slot_t){
+            .fn = fn,
+            .arg = arg,
+            .period = period,
+            .next_run = next_on_grid(xTaskGetTickCount(), period),
+        };
+        w->timer_count++;
+    } else {
+        ret = ESP_ERR_NO_MEM;
+    }
+    taskEXIT_CRITICAL(&w->lock);
+
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Out of timer slots on %s", w->name);
+        return ret;
+    }
+
+    // The worker may be waiting for a later timer or none at all. With its
+    // queue full it is about to wake anyway, the timer is registered either way.
+    executor_post(worker, NULL, NULL);
+    return ESP_OK;
+}
+
+esp_err_t executor_add_source(executor_worker_t worker, QueueHandle_t queue, executor_fn_t fn, void *arg) {
+    if (worker >= EXECUTOR_WORKER_COUNT || queue == NULL || fn == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    worker_t *w = &workers[worker];
+    UBaseType_t length = uxQueueSpacesAvailable(queue);
+    if (w->set == NULL || w->source_count == EXECUTOR_MAX_SOURCES ||
+        w->source_events + length > EXECUTOR_SOURCE_EVENTS) {
+        ESP_LOGE(TAG, "No room for another source on %s", w->name);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Registered before the set can report the queue
+    taskENTER_CRITICAL(&w->lock);
+    w->sources[w->source_count] = (source_slot_t){ .queue = queue, .fn = fn, .arg = arg };
+    w->source_count++;
+    taskEXIT_CRITICAL(&w->lock);
+
+    if (xQueueAddToSet(queue, w->set) != pdPASS) {
+        // Only an empty queue can join, nothing will report it
+        taskENTER_CRITICAL(&w->lock);
+        w->source_count--;
+        taskEXIT_CRITICAL(&w->lock);
+        ESP_LOGE(TAG, "Source queue is not empty");
+        return ESP_ERR_INVALID_STATE;
+    }
+    w->source_events += length;
+    return ESP_OK;
+}
@@ -0,0 +1,49 @@
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+// Periodic jobs, deferred work and queue driven event sources share a few
+// worker tasks instead of one polling task each. A worker runs its jobs to
+// completion one at a time and sleeps until the next timer is due or an item
+// arrives, so jobs must not block for long.
+typedef enum {
+    EXECUTOR_CONTROL,     // Throttle sampling and sending, nothing else queues ahead
+    EXECUTOR_BACKGROUND,  // Housekeeping: RSSI, inactivity, BLE setup, UART
+    EXECUTOR_WORKER_COUNT
+} executor_worker_t;
+
+#define EXECUTOR_CONTROL_PRIORITY 6
+#define EXECUTOR_BACKGROUND_PRIORITY 4
+#define EXECUTOR_STACK_SIZE 3072
+
+// Per worker limits
+#define EXECUTOR_QUEUE_LENGTH 8    // Pending work items
+#define EXECUTOR_MAX_TIMERS 6
+#define EXECUTOR_MAX_SOURCES 2
+#define EXECUTOR_SOURCE_EVENTS 16  // Sum of the lengths of the source queues
+
+// Set to 1 to log the unused stack of each worker every 10 s
+#define EXECUTOR_STATS 0
+
+typedef void (*executor_fn_t)(void *arg);
+
+// Start the workers, before any other executor function
+esp_err_t executor_init(void);
+
+// Run fn(arg) on the worker soon. Any task, fails if the queue is full.
+esp_err_t executor_post(executor_worker_t worker, executor_fn_t fn, void *arg);
+
+// Run fn(arg) every period_ms, on the multiples of the period in ticks, the
+// first time within one period from now. A late run is not caught up, the
+// missed runs are skipped.
+esp_err_t executor_every(executor_worker_t worker, uint32_t period_ms, executor_fn_t fn, void *arg);
+
+// Call fn(arg) whenever the queue has an item, fn must take exactly one. The
+// queue has to be empty when added.
+esp_err_t executor_add_source(executor_worker_t worker, QueueHandle_t queue, executor_fn_t fn, void *arg);
+
+#endif // EXECUTOR_H
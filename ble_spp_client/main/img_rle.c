@@ -0,0 +1,226 @@
+#include "img_rle.h"
+#include <string.h>
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "ui/ui.h"
+
+#define TAG "IMG_RLE"
+
+#define RLE_HEADER_SIZE 4
+#define RLE_ROW_OFFSET_SIZE 4
+#define RLE_RUN_SIZE 2
+
+#define BENCHMARK_WIDTH 240
+#define BENCHMARK_ROWS 48
+#define BENCHMARK_ITERATIONS 20
+
+// Pointers into the image data, set up once per open
+typedef struct {
+    const uint8_t *palette;
+    const uint8_t *rows;
+    const uint8_t *runs;
+    uint16_t palette_size;
+} rle_image_t;
+
+static uint32_t read_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static lv_res_t rle_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header) {
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) {
+        return LV_RES_INV;
+    }
+
+    const lv_img_dsc_t *img = src;
+    if (img->header.cf != IMG_RLE_CF) {
+        return LV_RES_INV;
+    }
+
+    *header = img->header;
+    return LV_RES_OK;
+}
+
+static lv_res_t rle_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    const lv_img_dsc_t *img = dsc->src;
+    const uint8_t *data = img->data;
+
+    if (img->data_size < RLE_HEADER_SIZE) {
+        return LV_RES_INV;
+    }
+
+    uint16_t palette_size = data[0] | (data[1] << 8);
+    size_t runs_start = RLE_HEADER_SIZE + palette_size * sizeof(lv_color_t) + img->header.h * RLE_ROW_OFFSET_SIZE;
+    if (palette_size == 0 || img->data_size < runs_start) {
+        ESP_LOGW(TAG, "Corrupt image: %lu bytes, %u colors", (unsigned long)img->data_size, palette_size);
+        return LV_RES_INV;
+    }
+
+    rle_image_t *rle = lv_mem_alloc(sizeof(rle_image_t));
+    if (rle == NULL) {
+        return LV_RES_INV;
+    }
+    rle->palette = data + RLE_HEADER_SIZE;
+    rle->rows = rle->palette + palette_size * sizeof(lv_color_t);
+    rle->runs = data + runs_start;
+    rle->palette_size = palette_size;
+
+    // No full frame, LVGL pulls the image through rle_read_line()
+    dsc->img_data = NULL;
+    dsc->user_data = rle;
+    return LV_RES_OK;
+}
+
+static lv_res_t rle_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc, lv_coord_t x, lv_coord_t y,
+                              lv_coord_t len, uint8_t *buf) {
+    const rle_image_t *rle = dsc->user_data;
+    const uint8_t *run = rle->runs + read_u32(rle->rows + y * RLE_ROW_OFFSET_SIZE);
+    lv_color_t *out = (lv_color_t *)buf;
+    lv_coord_t skip = x;
+
+    while (len > 0) {
+        lv_coord_t count = run[0];
+        uint8_t index = run[1];
+        run += RLE_RUN_SIZE;
+
+        if (count <= skip) {
+            skip -= count;
+            continue;
+        }
+        count -= skip;
+        skip = 0;
+        if (count > len) {
+            count = len;
+        }
+        if (index >= rle->palette_size) {
+            return LV_RES_INV;
+        }
+
+        lv_color_t color;
+        memcpy(&color, rle->palette + index * sizeof(lv_color_t), sizeof(lv_color_t));
+        lv_color_fill(out, color, count);
+        out += count;
+        len -= count;
+    }
+    return LV_RES_OK;
+}
+
+static void rle_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    lv_mem_free(dsc->user_data);
+    dsc->user_data = NULL;
+}
+
+void img_rle_init(void) {
+    // New decoders go to the head of the list, so this one is asked before the built-in one
+    lv_img_decoder_t *decoder = lv_img_decoder_create();
+    if (decoder == NULL) {
+        ESP_LOGE(TAG, "Failed to create image decoder");
+        return;
+    }
+    lv_img_decoder_set_info_cb(decoder, rle_info);
+    lv_img_decoder_set_open_cb(decoder, rle_open);
+    lv_img_decoder_set_read_line_cb(decoder, rle_read_line);
+    lv_img_decoder_set_close_cb(decoder, rle_close);
+}
+
+// Copy a band of a packed asset into TRUE_COLOR_ALPHA, i.e. the format SquareLine
+// exports. Every pixel goes through the alpha blend path when it is drawn.
+static uint8_t *make_alpha_copy(const lv_img_dsc_t *img, lv_coord_t first_row, lv_coord_t rows,
+                                lv_img_dsc_t *copy) {
+    static lv_color_t line[BENCHMARK_WIDTH];
+    lv_coord_t w = img->header.w;
+    lv_img_decoder_dsc_t dec;
+
+    if (w > BENCHMARK_WIDTH || lv_img_decoder_open(&dec, img, lv_color_black(), 0) != LV_RES_OK) {
+        return NULL;
+    }
+
+    uint8_t *data = heap_caps_malloc(LV_IMG_BUF_SIZE_TRUE_COLOR_ALPHA(w, rows), MALLOC_CAP_8BIT);
+    if (data == NULL) {
+        lv_img_decoder_close(&dec);
+        return NULL;
+    }
+
+    uint8_t *dst = data;
+    for (lv_coord_t y = first_row; y < first_row + rows; y++) {
+        const lv_color_t *src = line;
+        if (dec.img_data != NULL) {
+            src = (const lv_color_t *)dec.img_data + y * w;
+        } else {
+            lv_img_decoder_read_line(&dec, 0, y, w, (uint8_t *)line);
+        }
+        for (lv_coord_t x = 0; x < w; x++) {
+            memcpy(dst, &src[x], sizeof(lv_color_t));
+            dst[sizeof(lv_color_t)] = LV_OPA_COVER;
+            dst += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+    }
+    lv_img_decoder_close(&dec);
+
+    memset(copy, 0, sizeof(*copy));
+    copy->header.w = w;
+    copy->header.h = rows;
+    copy->header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    copy->data_size = LV_IMG_BUF_SIZE_TRUE_COLOR_ALPHA(w, rows);
+    copy->data = data;
+    return data;
+}
+
+static uint32_t time_draw(lv_obj_t *canvas, const void *src, lv_coord_t y) {
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        lv_canvas_draw_img(canvas, 0, y, src, &dsc);
+    }
+    return (esp_cpu_get_cycle_count() - start) / BENCHMARK_ITERATIONS;
+}
+
+void img_rle_benchmark(void) {
+    static const struct {
+        const char *name;
+        const lv_img_dsc_t *img;
+    } assets[] = {
+        { "gb", &ui_img_gb_png },
+        { "battery_icon", &ui_img_battery_icon_png },
+        { "no_connection", &ui_img_no_connection_png },
+    };
+
+    lv_color_t *canvas_buf = heap_caps_malloc(LV_CANVAS_BUF_SIZE_TRUE_COLOR(BENCHMARK_WIDTH, BENCHMARK_ROWS),
+                                              MALLOC_CAP_8BIT);
+    if (canvas_buf == NULL) {
+        ESP_LOGW(TAG, "No memory for the benchmark canvas");
+        return;
+    }
+    lv_obj_t *canvas = lv_canvas_create(lv_layer_sys());
+    lv_canvas_set_buffer(canvas, canvas_buf, BENCHMARK_WIDTH, BENCHMARK_ROWS, LV_IMG_CF_TRUE_COLOR);
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+
+    for (size_t i = 0; i < sizeof(assets) / sizeof(assets[0]); i++) {
+        const lv_img_dsc_t *img = assets[i].img;
+        lv_coord_t rows = LV_MIN(img->header.h, BENCHMARK_ROWS);
+        lv_coord_t first_row = (img->header.h - rows) / 2;
+        uint32_t pixels = img->header.w * rows;
+        lv_img_dsc_t alpha_copy;
+
+        // Same band of the image in both formats
+        uint32_t packed = time_draw(canvas, img, -first_row);
+        uint8_t *alpha_data = make_alpha_copy(img, first_row, rows, &alpha_copy);
+        if (alpha_data == NULL) {
+            ESP_LOGW(TAG, "%s: no memory for the alpha copy", assets[i].name);
+            continue;
+        }
+        uint32_t alpha = time_draw(canvas, &alpha_copy, 0);
+        heap_caps_free(alpha_data);
+
+        ESP_LOGI(TAG, "%s (%s, %lu bytes, was %lu): %lu cycles vs %lu with alpha for %lu px",
+                 assets[i].name, img->header.cf == IMG_RLE_CF ? "RLE" : "RGB565",
+                 (unsigned long)img->data_size,
+                 (unsigned long)LV_IMG_BUF_SIZE_TRUE_COLOR_ALPHA(img->header.w, img->header.h),
+                 (unsigned long)packed, (unsigned long)alpha, (unsigned long)pixels);
+    }
+
+    lv_obj_del(canvas);
+    heap_caps_free(canvas_buf);
+}
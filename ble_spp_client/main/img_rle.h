@@ -0,0 +1,24 @@
+#ifndef IMG_RLE_H
+#define IMG_RLE_H
+
+#include "lvgl.h"
+
+// Color format of the run-length encoded images written by tools/img_pack.py.
+// Data layout (little endian):
+//   u16 palette size, u16 reserved
+//   palette as lv_color_t
+//   u32 offset of every row, relative to the first run
+//   (u8 count, u8 palette index) runs, a run never crosses a row
+// Images are pre-blended on the screen background, so they are opaque.
+#define IMG_RLE_CF LV_IMG_CF_USER_ENCODED_0
+
+// Set to 1 to time drawing the screen assets against an alpha-blended copy at startup
+#define IMG_RLE_BENCHMARK 0
+
+// Register the decoder with LVGL. Call after lv_init(), before any screen is built.
+void img_rle_init(void);
+
+// Run the blit benchmark and log the results (LVGL must be initialised)
+void img_rle_benchmark(void);
+
+#endif // IMG_RLE_H
@@ -0,0 +1,24 @@
+#include "inactivity.h"
+
+void inactivity_init(inactivity_t *st, uint32_t timeout_ms, uint32_t reset_debounce_ms, uint32_t now_ms) {
+    st->timeout_ms = timeout_ms;
+    st->reset_debounce_ms = reset_debounce_ms;
+    st->last_activity_ms = now_ms;
+    st->last_reset_ms = now_ms - reset_debounce_ms;
+}
+
+void inactivity_reset(inactivity_t *st, uint32_t now_ms) {
+    // Only reset if enough time has passed since last reset
+    if (now_ms - st->last_reset_ms >= st->reset_debounce_ms) {
+        st->last_activity_ms = now_ms;
+        st->last_reset_ms = now_ms;
+    }
+}
+
+uint32_t inactivity_elapsed(const inactivity_t *st, uint32_t now_ms) {
+    return now_ms - st->last_activity_ms;
+}
+
+bool inactivity_expired(const inactivity_t *st, uint32_t now_ms, bool connected) {
+    return !connected && inactivity_elapsed(st, now_ms) > st->timeout_ms;
+}
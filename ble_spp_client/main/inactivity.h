@@ -0,0 +1,29 @@
+#ifndef INACTIVITY_H
+#define INACTIVITY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Decides when the remote has been idle long enough to sleep. It has no
+// hardware or RTOS dependencies, the sleep module feeds it activity and
+// the time in ms, which may wrap.
+
+typedef struct {
+    uint32_t timeout_ms;
+    uint32_t reset_debounce_ms;  // Activity closer together than this is not recorded
+    uint32_t last_activity_ms;
+    uint32_t last_reset_ms;
+} inactivity_t;
+
+void inactivity_init(inactivity_t *st, uint32_t timeout_ms, uint32_t reset_debounce_ms, uint32_t now_ms);
+
+// Something happened, the timeout starts over
+void inactivity_reset(inactivity_t *st, uint32_t now_ms);
+
+// Time since the last activity
+uint32_t inactivity_elapsed(const inactivity_t *st, uint32_t now_ms);
+
+// Idle past the timeout and nothing keeps the remote awake
+bool inactivity_expired(const inactivity_t *st, uint32_t now_ms, bool connected);
+
+#endif // INACTIVITY_H
@@ -10,6 +10,14 @@
 #include "ble_spp_client.h"
 #include "vesc_config.h"
 #include "ui_updater.h"
+#include "ui_cmd.h"
+#include "display_power.h"
+#include "power.h"
+#include "diagnostics.h"
+#include "boot.h"
+#include "sim_hw.h"
+
+#define TAG "LCD"
 
 // Static variables
 static esp_lcd_panel_handle_t panel_handle = NULL;
@@ -17,19 +25,23 @@ static lv_color_t *buf1 = NULL;
 static lv_color_t *buf2 = NULL;
 static lv_disp_draw_buf_t draw_buf;
 static lv_disp_drv_t disp_drv;
-static esp_timer_handle_t periodic_timer;
+static TaskHandle_t lvgl_task_handle = NULL;
+static esp_pm_lock_handle_t pm_lock = NULL;
+#if LCD_FLUSH_STATS
+static uint32_t flushed_pixels = 0;
+#endif
 
 
 // Function prototypes
 static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
-static void lv_tick_task(void *arg);
+static void monitor_cb(lv_disp_drv_t *drv, uint32_t time, uint32_t px);
 static void lvgl_handler_task(void *pvParameters);
-static void display_update_task(void *pvParameters);
 
 void lcd_init(void) {
-    // Configure GPIO20 and GPIO9
+#if !SIM_HW
+    // Configure GPIO20, the backlight on GPIO9 is driven by display_power
     gpio_config_t io_conf = {
-        .pin_bit_mask = (1ULL << GPIO_NUM_20) | (1ULL << GPIO_NUM_9),
+        .pin_bit_mask = (1ULL << GPIO_NUM_20),
         .mode = GPIO_MODE_OUTPUT,
         .pull_up_en = GPIO_PULLUP_DISABLE,
         .pull_down_en = GPIO_PULLDOWN_DISABLE,
@@ -37,9 +49,8 @@ void lcd_init(void) {
     };
     ESP_ERROR_CHECK(gpio_config(&io_conf));
 
-    // Set GPIO20 to 0 and GPIO9 to 1
+    // Set GPIO20 to 0
     ESP_ERROR_CHECK(gpio_set_level(GPIO_NUM_20, 0));
-    ESP_ERROR_CHECK(gpio_set_level(GPIO_NUM_9, 1));
 
     spi_bus_config_t buscfg = {
         .mosi_io_num = TFT_MOSI_PIN,
@@ -80,6 +91,11 @@ void lcd_init(void) {
     ESP_ERROR_CHECK(esp_lcd_panel_mirror(panel_handle, false, false));
     ESP_ERROR_CHECK(esp_lcd_panel_swap_xy(panel_handle, false));
     ESP_ERROR_CHECK(esp_lcd_panel_invert_color(panel_handle, true));
+#endif
+
+    // Backlight stays dark until LVGL has drawn the first frame. No panel in
+    // the simulated build, the flushes go to its framebuffer.
+    ESP_ERROR_CHECK(display_power_init(panel_handle));
 
     lv_init();
 
@@ -94,6 +110,7 @@ void lcd_init(void) {
 
     lv_disp_drv_init(&disp_drv);
     disp_drv.flush_cb = flush_cb;
+    disp_drv.monitor_cb = monitor_cb;
     disp_drv.draw_buf = &draw_buf;
     disp_drv.hor_res = LV_HOR_RES_MAX;
     disp_drv.ver_res = LV_VER_RES_MAX;
@@ -106,60 +123,98 @@ void lcd_init(void) {
     // Clear the screen to black at initialization
     //ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel_handle, 0, 0, LV_HOR_RES_MAX, LV_VER_RES_MAX, NULL));
 
-    const esp_timer_create_args_t periodic_timer_args = {
-        .callback = &lv_tick_task,
-        .name = "periodic_gui"
-    };
-    ESP_ERROR_CHECK(esp_timer_create(&periodic_timer_args, &periodic_timer));
-    ESP_ERROR_CHECK(esp_timer_start_periodic(periodic_timer, 1000));
-
+    // The LVGL tick comes from esp_timer_get_time() (CONFIG_LV_TICK_CUSTOM), no periodic interrupt needed
 
-    // Start display tasks
-    lcd_start_tasks();
+    // All LVGL calls from other tasks go through the UI command queue
+    ESP_ERROR_CHECK(ui_cmd_init());
 }
 
 static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
+#if SIM_HW
+    sim_hw_flush(area->x1, area->y1, area->x2, area->y2, (const uint16_t *)color_map);
+#else
     esp_lcd_panel_draw_bitmap(panel_handle, area->x1, area->y1, area->x2 + 1, area->y2 + 1, color_map);
+#endif
+#if LCD_FLUSH_STATS
+    flushed_pixels += lv_area_get_size(area);
+#endif
     lv_disp_flush_ready(drv);
 }
 
-static void lv_tick_task(void *arg) {
-    (void) arg;
-    lv_tick_inc(1);
+// Called by LVGL once a frame is drawn and handed to the panel
+static void monitor_cb(lv_disp_drv_t *drv, uint32_t time, uint32_t px) {
+    boot_mark(BOOT_STAGE_FIRST_FRAME);
+    display_power_frame_shown();
+    diagnostics_frame_rendered(time);
 }
 
-static void lvgl_handler_task(void *pvParameters) {
-    const TickType_t xFrequency = pdMS_TO_TICKS(10);
-    TickType_t xLastWakeTime = xTaskGetTickCount();
+#if LCD_FLUSH_STATS
+uint32_t lcd_get_flushed_pixels(void) {
+    return flushed_pixels;
+}
+#endif
 
-    while (1) {
-        lv_timer_handler();
-        vTaskDelayUntil(&xLastWakeTime, xFrequency);
+void lcd_wake(void) {
+    if (lvgl_task_handle != NULL) {
+        xTaskNotifyGive(lvgl_task_handle);
     }
 }
 
-static void display_update_task(void *pvParameters) {
-    vesc_config_t config;
-    ESP_ERROR_CHECK(vesc_config_load(&config));
+static void lvgl_handler_task(void *pvParameters) {
+#if LCD_WAKEUP_STATS
+    uint32_t wakeups = 0;
+    int64_t stats_start = esp_timer_get_time();
+#endif
 
     ui_updater_init();
 
     while (1) {
-        // Get latest values
-        int32_t speed = vesc_config_get_speed(&config);
-        ui_update_speed(speed);
-
-        // Update other values as needed
-        // ui_update_battery_voltage(...);
-        // ui_update_motor_current(...);
-        // etc.
-
-        vTaskDelay(pdMS_TO_TICKS(100));
+        // Render at full clock. The SPI driver holds its own lock until the
+        // queued flushes are out, so this is dropped before waiting.
+        power_lock_acquire(pm_lock);
+
+        // Apply queued UI commands so they render in this pass
+        ui_cmd_process();
+
+        // Widgets keep being updated while the panel sleeps, only rendering
+        // and LVGL timers stop until the next activity
+        uint32_t next_ms = LV_NO_TIMER_READY;
+        if (!display_power_is_off()) {
+            next_ms = lv_timer_handler();
+        }
+        uint32_t power_ms = display_power_update();
+        if (power_ms < next_ms) {
+            next_ms = power_ms;
+        }
+        power_lock_release(pm_lock);
+
+        // Sleep until the next LVGL timer or display power step is due, or a
+        // command/telemetry update arrives
+        TickType_t wait = portMAX_DELAY;
+        if (next_ms != LV_NO_TIMER_READY) {
+            wait = pdMS_TO_TICKS(next_ms);
+            if (wait == 0 && next_ms > 0) {
+                wait = 1;
+            }
+        }
+        if (wait > 0) {
+            ulTaskNotifyTake(pdTRUE, wait);
+        }
+
+#if LCD_WAKEUP_STATS
+        wakeups++;
+        int64_t elapsed_us = esp_timer_get_time() - stats_start;
+        if (elapsed_us >= 10 * 1000 * 1000) {
+            ESP_LOGI(TAG, "LVGL task: %lu wake-ups in %lld ms", (unsigned long)wakeups, elapsed_us / 1000);
+            wakeups = 0;
+            stats_start = esp_timer_get_time();
+        }
+#endif
     }
 }
 
+// Must be called once the UI is built, LVGL is only touched by this task afterwards
 void lcd_start_tasks(void) {
-    xTaskCreate(lvgl_handler_task, "lvgl_handler", 4096, NULL, 5, NULL);
-    xTaskCreate(display_update_task, "display_update", 2048, NULL, 5, NULL);
+    pm_lock = power_lock_create(ESP_PM_CPU_FREQ_MAX, "lvgl");
+    xTaskCreate(lvgl_handler_task, "lvgl_handler", 4096, NULL, 5, &lvgl_task_handle);
 }
-
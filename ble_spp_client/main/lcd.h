@@ -12,10 +12,17 @@
 #define TFT_CS_PIN   GPIO_NUM_6
 #define TFT_DC_PIN   GPIO_NUM_7
 #define TFT_RST_PIN  GPIO_NUM_21
+#define TFT_BL_PIN   GPIO_NUM_9
 
 #define LV_HOR_RES_MAX 240
 #define LV_VER_RES_MAX 320
 
+// Set to 1 to log how often the LVGL task wakes up
+#define LCD_WAKEUP_STATS 0
+
+// Set to 1 to count flushed pixels and log them for every screen change
+#define LCD_FLUSH_STATS 0
+
 // Function declarations
 void lcd_init(void);
 lv_obj_t* lcd_create_label(const char* initial_text);
@@ -23,4 +30,12 @@ void lcd_start_tasks(void);
 void lcd_enable_update(void);
 void lcd_disable_update(void);
 
+// Wake the LVGL task early, e.g. after queueing a UI command
+void lcd_wake(void);
+
+#if LCD_FLUSH_STATS
+// Pixels sent to the panel since boot
+uint32_t lcd_get_flushed_pixels(void);
+#endif
+
 
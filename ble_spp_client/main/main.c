@@ -12,21 +12,54 @@
 #include "button.h"
 #include "ui/ui.h"  // Generated by SquareLine Studio
 #include "vesc_config.h"
+#include "ui_cmd.h"
+#include "screen_manager.h"
+#include "asset_pack.h"
+#include "power.h"
+#include "executor.h"
+#include "diagnostics.h"
+#include "boot.h"
+#include "resume.h"
+#include "ride_log.h"
+#include "trip.h"
+#include "settings.h"
+#include "sim_hw.h"
 
 #define TAG "MAIN"
 
+// Stacks of the one-off init tasks, freed once they are done
+#define BOOT_BLE_STACK_SIZE 4096
+#define BOOT_ADC_STACK_SIZE 3072
 
-extern bool is_connect;
-
-static void splash_timer_cb(lv_timer_t * timer)
+static void ble_init(void)
 {
-    lv_disp_load_scr(ui_home_screen);  // Switch to home screen after timeout
+    spp_client_demo_init();
+    ESP_LOGI(TAG, "BLE Initialization complete");
 }
 
 void app_main(void)
 {
+    boot_mark(BOOT_STAGE_START);
     ESP_LOGI(TAG, "Starting Application");
 
+    // After a button wake from deep sleep, calibration, config, peer and
+    // screen come from RTC memory
+    resume_init();
+
+    // Frequency scaling and light sleep, before any driver takes a PM lock
+    ESP_ERROR_CHECK(power_init());
+
+    // Workers for periodic jobs and deferred work
+    ESP_ERROR_CHECK(executor_init());
+
+    // Runtime figures for the diagnostics screen and the UART dump
+    diagnostics_init();
+
+#if SIM_HW
+    // Scripted throttle, button and panel, before their drivers start
+    ESP_ERROR_CHECK(sim_hw_start());
+#endif
+
     // Initialize sleep module
     sleep_init();
 
@@ -38,40 +71,48 @@ void app_main(void)
     }
     ESP_ERROR_CHECK(ret);
 
+    // Calibration and VESC config, one blob read before anything uses them
+    ESP_ERROR_CHECK(settings_init());
+    boot_mark(BOOT_STAGE_NVS);
+
+    // BLE bring-up and the ADC (calibration included) don't depend on the
+    // display or each other, they run alongside the panel bring-up below.
+    // The throttle is only sent once the ADC is ready.
+    ESP_ERROR_CHECK(boot_run("boot_ble", ble_init, BOOT_STAGE_BLE_READY, BOOT_BLE_STACK_SIZE));
+    ESP_ERROR_CHECK(boot_run("boot_adc", adc_start_task, BOOT_STAGE_ADC_READY, BOOT_ADC_STACK_SIZE));
+
     // Initialize VESC configuration
     ESP_ERROR_CHECK(vesc_config_init());
 
-    // Initialize ADC and start tasks
-    ESP_ERROR_CHECK(adc_init());
-    adc_start_task();
+    // Ride telemetry, the app runs without it when the partition is missing
+    ride_log_init();
+    ESP_ERROR_CHECK(trip_init());
 
-    // Wait for ADC calibration
-    while (!adc_is_calibrated()) {
-        vTaskDelay(pdMS_TO_TICKS(100));
-    }
-
-    // Initialize BLE
-    spp_client_demo_init();
-    ESP_LOGI(TAG, "BLE Initialization complete");
+    // Map fonts and images from the asset partition, the UI still starts without them
+    asset_pack_init();
+    boot_mark(BOOT_STAGE_CONFIG);
 
     // Initialize LCD and LVGL
     lcd_init();
-
+    boot_mark(BOOT_STAGE_LCD);
+
+    // Screens are built on first use, the splash screen is freed once it has
+    // been shown. It gives way to the home screen once BLE is up. A wake
+    // from deep sleep goes straight back to the last screen.
+    screen_manager_init();
+    if (resume_is_warm()) {
+        // The home screen owns the status bar widgets, it is built first
+        screen_manager_load(UI_SCREEN_HOME);
+        screen_manager_load(resume_get_screen());
+    } else {
+        screen_manager_load(UI_SCREEN_SPLASH);
+    }
+    lcd_start_tasks();
+    boot_mark(BOOT_STAGE_UI);
 
     // Start sleep monitoring
     sleep_start_monitoring();
 
-    // Initialize SquareLine Studio UI
-    ui_init();
-    lv_disp_load_scr(ui_splash_screen);  // Load splash screen first
-    lv_timer_t * splash_timer = lv_timer_create(splash_timer_cb, 1000, NULL);  // Create timer for 1 seconds
-    lv_timer_set_repeat_count(splash_timer, 1);  // Run only once
-
-    // Main task can now sleep
-    while (1) {
-        sleep_check_inactivity(is_connect);
-
-        vTaskDelay(pdMS_TO_TICKS(100));
-    }
+    // Everything runs on the executor, the LVGL task or a timer from here, app_main returns
 }
 
@@ -0,0 +1,72 @@
+#include "power.h"
+#include <stdio.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#define TAG "POWER"
+
+#if POWER_STATS
+static void stats_timer_cb(void *arg) {
+    esp_pm_dump_locks(stdout);
+}
+
+static void start_stats(void) {
+    const esp_timer_create_args_t args = {
+        .callback = stats_timer_cb,
+        .name = "pm_stats",
+        .skip_unhandled_events = true,
+    };
+    esp_timer_handle_t timer;
+
+    if (esp_timer_create(&args, &timer) == ESP_OK) {
+        esp_timer_start_periodic(timer, POWER_STATS_PERIOD_MS * 1000ULL);
+    }
+}
+#endif
+
+esp_err_t power_init(void) {
+    const esp_pm_config_t config = {
+        .max_freq_mhz = POWER_MAX_FREQ_MHZ,
+        .min_freq_mhz = POWER_MIN_FREQ_MHZ,
+        .light_sleep_enable = POWER_LIGHT_SLEEP,
+    };
+
+    esp_err_t ret = esp_pm_configure(&config);
+    if (ret == ESP_ERR_NOT_SUPPORTED) {
+        ESP_LOGW(TAG, "Power management disabled in the config, CPU stays at full speed");
+        return ESP_OK;
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Power management configuration failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "CPU %d-%d MHz, light sleep %s", POWER_MIN_FREQ_MHZ, POWER_MAX_FREQ_MHZ,
+             POWER_LIGHT_SLEEP ? "on" : "off");
+#if POWER_STATS
+    start_stats();
+#endif
+    return ESP_OK;
+}
+
+esp_pm_lock_handle_t power_lock_create(esp_pm_lock_type_t type, const char *name) {
+    esp_pm_lock_handle_t lock = NULL;
+
+    esp_err_t ret = esp_pm_lock_create(type, 0, name, &lock);
+    if (ret != ESP_OK && ret != ESP_ERR_NOT_SUPPORTED) {
+        ESP_LOGW(TAG, "No PM lock for %s: %s", name, esp_err_to_name(ret));
+    }
+    return ret == ESP_OK ? lock : NULL;
+}
+
+void power_lock_acquire(esp_pm_lock_handle_t lock) {
+    if (lock != NULL) {
+        esp_pm_lock_acquire(lock);
+    }
+}
+
+void power_lock_release(esp_pm_lock_handle_t lock) {
+    if (lock != NULL) {
+        esp_pm_lock_release(lock);
+    }
+}
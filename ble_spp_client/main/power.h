@@ -0,0 +1,36 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include "esp_err.h"
+#include "esp_pm.h"
+#include "sim_hw.h"
+
+// CPU clock range for dynamic frequency scaling. 40 MHz is the XTAL, the
+// lowest clock that still keeps the BLE link and the peripherals running.
+#define POWER_MAX_FREQ_MHZ 160
+#define POWER_MIN_FREQ_MHZ 40
+
+// Light sleep between FreeRTOS ticks while no PM lock is held. Set to 0 to
+// keep only frequency scaling, e.g. while debugging over JTAG. Always off
+// in the simulated build, QEMU timings are taken without it.
+#if SIM_HW
+#define POWER_LIGHT_SLEEP 0
+#else
+#define POWER_LIGHT_SLEEP 1
+#endif
+
+// Set to 1 to dump the PM locks periodically. With CONFIG_PM_PROFILING the
+// dump also has the time spent in each mode, which gives the sleep ratio.
+#define POWER_STATS 0
+#define POWER_STATS_PERIOD_MS 30000
+
+// Enable frequency scaling and light sleep, call before the drivers start
+esp_err_t power_init(void);
+
+// Locks that tolerate power management being disabled in the config: create
+// returns NULL then, and acquire/release ignore a NULL lock.
+esp_pm_lock_handle_t power_lock_create(esp_pm_lock_type_t type, const char *name);
+void power_lock_acquire(esp_pm_lock_handle_t lock);
+void power_lock_release(esp_pm_lock_handle_t lock);
+
+#endif // POWER_H
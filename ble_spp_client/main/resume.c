@@ -0,0 +1,120 @@
+#include "resume.h"
+#include <stddef.h>
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "esp_sleep.h"
+
+#define TAG "RESUME"
+
+// Changed whenever the layout of retained_t changes
+#define RESUME_MAGIC 0x52534d33  // "RSM3"
+
+#define HAS_SETTINGS (1 << 0)
+#define HAS_PEER     (1 << 1)
+#define HAS_SCREEN   (1 << 2)
+#define HAS_TRIP     (1 << 3)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t flags;
+    settings_t settings;
+    resume_peer_t peer;
+    uint8_t screen;
+    trip_totals_t trip;
+    uint32_t crc;  // Over everything before it
+} retained_t;
+
+// Left alone by the bootloader on a deep sleep wake, loaded with zeros on
+// any other reset
+static RTC_DATA_ATTR retained_t retained;
+static bool warm = false;
+
+static uint32_t retained_crc(void) {
+    return esp_rom_crc32_le(0, (const uint8_t *)&retained, offsetof(retained_t, crc));
+}
+
+void resume_init(void) {
+    bool gpio_wake = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO;
+
+    warm = gpio_wake && retained.magic == RESUME_MAGIC && retained.crc == retained_crc();
+    if (!warm) {
+        if (gpio_wake) {
+            ESP_LOGW(TAG, "Retained state invalid, cold boot");
+        }
+        memset(&retained, 0, sizeof(retained));
+    }
+    // Sealed again on the way into deep sleep, a reset in between must not
+    // trust fields that changed since
+    retained.magic = 0;
+    ESP_LOGI(TAG, "%s boot", warm ? "Warm" : "Cold");
+}
+
+bool resume_is_warm(void) {
+    return warm;
+}
+
+void resume_prepare_sleep(void) {
+    retained.magic = RESUME_MAGIC;
+    retained.crc = retained_crc();
+}
+
+static bool has(uint32_t flag) {
+    return warm && (retained.flags & flag);
+}
+
+bool resume_get_settings(settings_t *settings) {
+    if (!has(HAS_SETTINGS)) {
+        return false;
+    }
+    *settings = retained.settings;
+    return true;
+}
+
+void resume_set_settings(const settings_t *settings) {
+    retained.settings = *settings;
+    retained.flags |= HAS_SETTINGS;
+}
+
+bool resume_get_peer(resume_peer_t *peer) {
+    if (!has(HAS_PEER)) {
+        return false;
+    }
+    *peer = retained.peer;
+    return true;
+}
+
+void resume_set_peer(const resume_peer_t *peer) {
+    retained.peer = *peer;
+    retained.flags |= HAS_PEER;
+}
+
+void resume_forget_peer(void) {
+    retained.flags &= ~HAS_PEER;
+}
+
+ui_screen_t resume_get_screen(void) {
+    if (!has(HAS_SCREEN) || retained.screen >= UI_SCREEN_MAX) {
+        return UI_SCREEN_HOME;
+    }
+    return (ui_screen_t)retained.screen;
+}
+
+void resume_set_screen(ui_screen_t screen) {
+    retained.screen = (uint8_t)screen;
+    retained.flags |= HAS_SCREEN;
+}
+
+bool resume_get_trip(trip_totals_t *totals) {
+    if (!has(HAS_TRIP)) {
+        return false;
+    }
+    *totals = retained.trip;
+    return true;
+}
+
+void resume_set_trip(const trip_totals_t *totals) {
+    retained.trip = *totals;
+    retained.flags |= HAS_TRIP;
+}
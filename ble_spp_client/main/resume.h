@@ -0,0 +1,56 @@
+#ifndef RESUME_H
+#define RESUME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "settings.h"
+#include "screen_manager.h"
+#include "trip.h"
+
+// State kept in RTC memory over deep sleep, so a button wake skips the NVS
+// reads, the scan and the service discovery of a cold boot. Any other reset
+// starts from a cold boot.
+
+// Attributes of the SPP service kept for the peer, enough for the client's
+// attribute table
+#define RESUME_MAX_ATTRS 10
+
+typedef struct {
+    uint8_t bda[6];
+    uint8_t addr_type;
+    uint16_t service_start;
+    uint16_t service_end;
+    uint16_t attr_count;
+    uint16_t handles[RESUME_MAX_ATTRS];
+    uint8_t properties[RESUME_MAX_ATTRS];
+} resume_peer_t;
+
+// Check the retained state, first thing in app_main. It is only used after
+// a GPIO wake from deep sleep and dropped otherwise.
+void resume_init(void);
+
+// True when this boot continues from deep sleep with valid state
+bool resume_is_warm(void);
+
+// Seal the state, right before esp_deep_sleep_start()
+void resume_prepare_sleep(void);
+
+// Each getter returns false when nothing was kept. The setters record the
+// current value on every boot, warm or cold.
+bool resume_get_settings(settings_t *settings);
+void resume_set_settings(const settings_t *settings);
+
+bool resume_get_peer(resume_peer_t *peer);
+void resume_set_peer(const resume_peer_t *peer);
+// The peer did not answer or its attributes changed, scan next time
+void resume_forget_peer(void);
+
+// Last screen of the cycle, UI_SCREEN_HOME when none was kept
+ui_screen_t resume_get_screen(void);
+void resume_set_screen(ui_screen_t screen);
+
+// Trip and odometer as of the last trip_flush()
+bool resume_get_trip(trip_totals_t *totals);
+void resume_set_trip(const trip_totals_t *totals);
+
+#endif // RESUME_H
@@ -0,0 +1,241 @@
+#include "ride_log.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+#include "adc.h"
+#include "ble_spp_client.h"
+#include "vesc_config.h"
+#include "executor.h"
+
+#define TAG "RIDE_LOG"
+
+#define EXPORT_STACK_SIZE 3072
+#define EXPORT_PRIORITY (tskIDLE_PRIORITY + 1)
+#define EXPORT_CHUNK 64  // Bytes read and printed at a time
+
+static const esp_partition_t *partition = NULL;
+static SemaphoreHandle_t mutex = NULL;  // The page and the ring position
+static uint32_t page_count;
+static uint32_t next_page;  // Sector the next page is written to
+static uint32_t next_seq;
+static uint32_t session;
+static volatile bool ready = false;
+static volatile bool exporting = false;
+static vesc_config_t gearing;
+static ride_log_writer_t writer;
+
+static void start_page(uint32_t now_ms) {
+    ride_log_page_start(&writer, now_ms, gearing.motor_pulley, gearing.wheel_pulley, gearing.wheel_diameter_mm,
+                        gearing.motor_poles);
+}
+
+// Mutex held
+static void write_page(void) {
+    ride_log_page_t *page = &writer.page;
+
+    if (page->header.records == 0) {
+        return;
+    }
+
+    page->header.seq = next_seq;
+    page->header.session = session;
+    page->header.crc = esp_rom_crc32_le(0, page->payload, page->header.payload_len);
+
+    // Only what was filled is written, the rest of the sector stays erased
+    size_t offset = next_page * RIDE_LOG_PAGE_SIZE;
+    esp_err_t ret = esp_partition_erase_range(partition, offset, RIDE_LOG_PAGE_SIZE);
+    if (ret == ESP_OK) {
+        ret = esp_partition_write(partition, offset, page, sizeof(page->header) + page->header.payload_len);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Page %lu not written: %s", (unsigned long)next_page, esp_err_to_name(ret));
+    }
+
+    next_page = (next_page + 1) % page_count;
+    next_seq++;
+    page->header.records = 0;
+    page->header.payload_len = 0;
+}
+
+static void sample(void *arg) {
+    if (!ready) {
+        return;
+    }
+    if (!is_connect) {
+        // The ride is over, keep what there is
+        if (writer.page.header.records > 0) {
+            ride_log_flush();
+        }
+        return;
+    }
+
+    const int32_t values[RIDE_LOG_FIELD_COUNT] = {
+        [RIDE_LOG_FIELD_THROTTLE] = (int32_t)adc_get_latest_value(),
+        [RIDE_LOG_FIELD_ERPM] = get_latest_erpm(),
+        [RIDE_LOG_FIELD_VOLTAGE] = get_latest_voltage_dv(),
+        [RIDE_LOG_FIELD_CURRENT_MOTOR] = get_latest_current_motor_da(),
+        [RIDE_LOG_FIELD_CURRENT_IN] = get_latest_current_in_da(),
+        [RIDE_LOG_FIELD_AMP_HOURS] = get_latest_amp_hours_cah(),
+        [RIDE_LOG_FIELD_LINK] = get_connection_quality(),
+    };
+    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (writer.page.header.records == 0) {
+        start_page(now_ms);
+    }
+    if (!ride_log_page_append(&writer, values, now_ms)) {
+        write_page();
+        start_page(now_ms);
+        ride_log_page_append(&writer, values, now_ms);
+    }
+    xSemaphoreGive(mutex);
+}
+
+static bool read_header(uint32_t index, ride_log_header_t *header) {
+    if (esp_partition_read(partition, index * RIDE_LOG_PAGE_SIZE, header, sizeof(*header)) != ESP_OK) {
+        return false;
+    }
+    return header->magic == RIDE_LOG_MAGIC && header->version == RIDE_LOG_VERSION &&
+           header->payload_len <= RIDE_LOG_PAYLOAD_SIZE;
+}
+
+// Continue after the newest page, in a new session
+static void find_end(void *arg) {
+    ride_log_header_t header;
+    bool found = false;
+    uint32_t newest = 0;
+    uint32_t newest_seq = 0;
+    uint32_t last_session = 0;
+
+    for (uint32_t i = 0; i < page_count; i++) {
+        if (!read_header(i, &header)) {
+            continue;
+        }
+        if (!found || (int32_t)(header.seq - newest_seq) > 0) {
+            newest_seq = header.seq;
+            newest = i;
+        }
+        if (!found || (int32_t)(header.session - last_session) > 0) {
+            last_session = header.session;
+        }
+        found = true;
+    }
+    if (found) {
+        next_page = (newest + 1) % page_count;
+        next_seq = newest_seq + 1;
+        session = last_session + 1;
+    }
+
+    ESP_LOGI(TAG, "Session %lu, next page %lu of %lu", (unsigned long)session, (unsigned long)next_page,
+             (unsigned long)page_count);
+    ready = true;
+}
+
+// A page is decoded with a single gearing, the new one starts a new page
+static void config_changed(const vesc_config_t *config) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (ready) {
+        write_page();
+    }
+    gearing = *config;
+    xSemaphoreGive(mutex);
+}
+
+esp_err_t ride_log_init(void) {
+    if (partition != NULL) {
+        return ESP_OK;
+    }
+
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, RIDE_LOG_PARTITION);
+    if (partition == NULL) {
+        ESP_LOGE(TAG, "Partition '%s' not found, nothing is logged", RIDE_LOG_PARTITION);
+        return ESP_ERR_NOT_FOUND;
+    }
+    page_count = partition->size / RIDE_LOG_PAGE_SIZE;
+
+    mutex = xSemaphoreCreateMutex();
+    if (mutex == NULL) {
+        partition = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    vesc_config_get(&gearing);
+    vesc_config_subscribe(config_changed);
+
+    // The scan reads a header from every sector, it does not hold up boot
+    esp_err_t ret = executor_post(EXECUTOR_BACKGROUND, find_end, NULL);
+    if (ret == ESP_OK) {
+        ret = executor_every(EXECUTOR_BACKGROUND, RIDE_LOG_PERIOD_MS, sample, NULL);
+    }
+    return ret;
+}
+
+void ride_log_flush(void) {
+    if (!ready) {
+        return;
+    }
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    write_page();
+    xSemaphoreGive(mutex);
+}
+
+static void print_hex(uint32_t offset, size_t len) {
+    uint8_t chunk[EXPORT_CHUNK];
+    char hex[EXPORT_CHUNK * 2 + 1];
+
+    while (len > 0) {
+        size_t n = len < sizeof(chunk) ? len : sizeof(chunk);
+        if (esp_partition_read(partition, offset, chunk, n) != ESP_OK) {
+            return;
+        }
+        for (size_t i = 0; i < n; i++) {
+            snprintf(hex + i * 2, 3, "%02x", chunk[i]);
+        }
+        fputs(hex, stdout);
+        offset += n;
+        len -= n;
+    }
+}
+
+// Oldest page first. A page overwritten meanwhile fails its CRC on the host.
+static void export_task(void *param) {
+    ride_log_header_t header;
+    uint32_t first;
+
+    ride_log_flush();
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    first = next_page;
+    xSemaphoreGive(mutex);
+
+    printf(RIDE_LOG_EXPORT_PREFIX "begin %lu\n", (unsigned long)page_count);
+    for (uint32_t i = 0; i < page_count; i++) {
+        uint32_t index = (first + i) % page_count;
+        if (!read_header(index, &header)) {
+            continue;
+        }
+        fputs(RIDE_LOG_EXPORT_PREFIX, stdout);
+        print_hex(index * RIDE_LOG_PAGE_SIZE, sizeof(header) + header.payload_len);
+        fputs("\n", stdout);
+    }
+    printf(RIDE_LOG_EXPORT_PREFIX "end\n");
+
+    exporting = false;
+    vTaskDelete(NULL);
+}
+
+void ride_log_export(void) {
+    if (!ready || exporting) {
+        return;
+    }
+    exporting = true;
+    if (xTaskCreate(export_task, "ride_log_export", EXPORT_STACK_SIZE, NULL, EXPORT_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to start the export");
+        exporting = false;
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef RIDE_LOG_H
+#define RIDE_LOG_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "ride_log_page.h"
+
+// Telemetry recorder. While connected, a record is taken every
+// RIDE_LOG_PERIOD_MS and appended to a page in RAM. Full pages go to the
+// "ridelog" partition, a ring of flash sectors where the oldest page is
+// overwritten, so flash is erased and written once per page only.
+// tools/ride_log.py turns a partition dump or a UART export into CSV and
+// per ride statistics, the page layout is described there and in
+// ride_log_page.h.
+#define RIDE_LOG_PARTITION "ridelog"
+
+#define RIDE_LOG_PERIOD_MS 200
+
+// Sent over UART0 (followed by a newline), prints the whole log instead of
+// forwarding the line to the controller
+#define RIDE_LOG_EXPORT_CMD "ridelog"
+#define RIDE_LOG_EXPORT_PREFIX "RLOG "
+
+// Find the partition and resume after the newest page, sampling starts
+// once that is done. Background worker.
+esp_err_t ride_log_init(void);
+
+// Write the page in RAM, before deep sleep. Any task, blocks for the erase
+// and write of one sector.
+void ride_log_flush(void);
+
+// Print every page as one hex line prefixed with RIDE_LOG_EXPORT_PREFIX on
+// a task of its own, at the UART's pace. Any task.
+void ride_log_export(void);
+
+#endif // RIDE_LOG_H
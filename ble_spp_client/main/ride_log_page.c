@@ -0,0 +1,56 @@
+#include "ride_log_page.h"
+#include <string.h>
+
+// Time and every field at their longest varint
+#define MAX_RECORD_SIZE (5 * (1 + RIDE_LOG_FIELD_COUNT))
+
+static size_t put_varint(uint8_t *out, uint32_t value) {
+    size_t len = 0;
+
+    while (value >= 0x80) {
+        out[len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[len++] = (uint8_t)value;
+    return len;
+}
+
+static uint32_t zigzag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+void ride_log_page_start(ride_log_writer_t *w, uint32_t now_ms, uint8_t motor_pulley, uint8_t wheel_pulley,
+                         uint8_t wheel_diameter_mm, uint8_t motor_poles) {
+    w->page.header = (ride_log_header_t){
+        .magic = RIDE_LOG_MAGIC,
+        .version = RIDE_LOG_VERSION,
+        .t0_ms = now_ms,
+        .motor_pulley = motor_pulley,
+        .wheel_pulley = wheel_pulley,
+        .wheel_diameter_mm = wheel_diameter_mm,
+        .motor_poles = motor_poles,
+    };
+    memset(w->prev_values, 0, sizeof(w->prev_values));
+    w->prev_ms = now_ms;
+}
+
+bool ride_log_page_append(ride_log_writer_t *w, const int32_t values[RIDE_LOG_FIELD_COUNT], uint32_t now_ms) {
+    uint8_t record[MAX_RECORD_SIZE];
+    uint32_t units = (now_ms - w->prev_ms + RIDE_LOG_TIME_UNIT_MS / 2) / RIDE_LOG_TIME_UNIT_MS;
+    size_t len = put_varint(record, units);
+
+    for (int i = 0; i < RIDE_LOG_FIELD_COUNT; i++) {
+        len += put_varint(record + len, zigzag(values[i] - w->prev_values[i]));
+    }
+    if (w->page.header.payload_len + len > RIDE_LOG_PAYLOAD_SIZE) {
+        return false;
+    }
+
+    // Advance by what was stored, rounding must not add up over a page
+    w->prev_ms += units * RIDE_LOG_TIME_UNIT_MS;
+    memcpy(w->prev_values, values, sizeof(w->prev_values));
+    memcpy(w->page.payload + w->page.header.payload_len, record, len);
+    w->page.header.payload_len += len;
+    w->page.header.records++;
+    return true;
+}
@@ -0,0 +1,73 @@
+#ifndef RIDE_LOG_PAGE_H
+#define RIDE_LOG_PAGE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Page layout and record encoding of the ride log, shared by ride_log.c and
+// the host round trip test against tools/ride_log.py. It has no hardware or
+// RTOS dependencies, ride_log.c hands it the values and the time.
+#define RIDE_LOG_MAGIC 0x474F4C52  // "RLOG"
+#define RIDE_LOG_VERSION 1
+#define RIDE_LOG_PAGE_SIZE 4096    // One flash sector
+
+// Time between records is stored in these units, gaps up to 127 of them
+// still take one byte
+#define RIDE_LOG_TIME_UNIT_MS 10
+
+// Record fields, in the order they are encoded
+typedef enum {
+    RIDE_LOG_FIELD_THROTTLE,       // 0-255 as sent
+    RIDE_LOG_FIELD_ERPM,
+    RIDE_LOG_FIELD_VOLTAGE,        // dV
+    RIDE_LOG_FIELD_CURRENT_MOTOR,  // dA
+    RIDE_LOG_FIELD_CURRENT_IN,     // dA
+    RIDE_LOG_FIELD_AMP_HOURS,      // cAh
+    RIDE_LOG_FIELD_LINK,           // %
+    RIDE_LOG_FIELD_COUNT
+} ride_log_field_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t payload_len;
+    uint32_t seq;          // Page number over the life of the log
+    uint32_t session;      // Boot the page was written in
+    uint32_t t0_ms;        // Uptime at the first record
+    uint16_t records;
+    uint8_t motor_pulley;  // Gearing for the speed, from the VESC config
+    uint8_t wheel_pulley;
+    uint8_t wheel_diameter_mm;
+    uint8_t motor_poles;
+    uint16_t reserved;
+    uint32_t crc;          // crc32 of the payload
+} ride_log_header_t;
+
+_Static_assert(sizeof(ride_log_header_t) == 32, "page header must match tools/ride_log.py");
+
+#define RIDE_LOG_PAYLOAD_SIZE (RIDE_LOG_PAGE_SIZE - sizeof(ride_log_header_t))
+
+// As written to flash, the header and the filled part of the payload
+typedef struct {
+    ride_log_header_t header;
+    uint8_t payload[RIDE_LOG_PAYLOAD_SIZE];
+} ride_log_page_t;
+
+// A page being filled. Each page starts from zero, so it decodes on its own.
+typedef struct {
+    ride_log_page_t page;
+    int32_t prev_values[RIDE_LOG_FIELD_COUNT];
+    uint32_t prev_ms;
+} ride_log_writer_t;
+
+// Empty page with its first record taken at now_ms. seq, session and crc
+// are filled in by whoever writes it out.
+void ride_log_page_start(ride_log_writer_t *w, uint32_t now_ms, uint8_t motor_pulley, uint8_t wheel_pulley,
+                         uint8_t wheel_diameter_mm, uint8_t motor_poles);
+
+// Time since the previous record, then the change of every field. False
+// and the page unchanged when the record does not fit.
+bool ride_log_page_append(ride_log_writer_t *w, const int32_t values[RIDE_LOG_FIELD_COUNT], uint32_t now_ms);
+
+#endif // RIDE_LOG_PAGE_H
@@ -0,0 +1,197 @@
+#include "screen_manager.h"
+#include <stddef.h>
+#include "esp_log.h"
+#include "ui/ui.h"
+#include "img_rle.h"
+#include "static_layer.h"
+#include "status_bar.h"
+#include "lcd.h"
+#include "diag_screen.h"
+#include "resume.h"
+
+#define TAG "SCREEN_MGR"
+
+typedef enum {
+    SCREEN_KEEP,            // Built once, kept for the lifetime of the app
+    SCREEN_FREE_ON_LEAVE,   // Rebuilt every time it is shown
+    SCREEN_SHOW_ONCE        // Freed after it has been shown, never needed again
+} screen_policy_t;
+
+typedef struct {
+    const char *name;
+    lv_obj_t **screen;
+    void (*init)(void);          // SquareLine constructor
+    lv_obj_t **const *widgets;   // Widget pointers that dangle once the screen is freed
+    size_t widget_count;
+    lv_obj_t **const *static_widgets;  // Never change, drawn from a snapshot
+    size_t static_count;
+    lv_obj_t **const *status_widgets;  // Moved into the shared status bar once built
+    size_t status_count;
+    bool status_bar;             // Shown below the status bar instead of full screen
+    screen_policy_t policy;
+    bool resume;                 // Shown again right away after a wake from deep sleep
+} screen_entry_t;
+
+static lv_obj_t **const home_widgets[] = {
+    &ui_Label1, &ui_Label2, &ui_Bar2, &ui_Bar3, &ui_Label5,
+};
+
+static lv_obj_t **const shutdown_widgets[] = {
+    &ui_shutdown, &ui_Bar4,
+};
+
+static lv_obj_t **const detailed_widgets[] = {
+    &ui_vesc_voltage, &ui_vesc_motor_current, &ui_battery_current, &ui_vesc_consumption, &ui_Label3,
+};
+
+static lv_obj_t **const splash_widgets[] = {
+    &ui_Image2, &ui_Image3,
+};
+
+static lv_obj_t **const home_static[] = {
+    &ui_Label2,
+};
+
+static lv_obj_t **const detailed_static[] = {
+    &ui_Label3,
+};
+
+// Designed on the home screen, shown on every screen with the status bar
+static lv_obj_t **const home_status[] = {
+    &ui_controller_battery_icon, &ui_controller_battery_text, &ui_no_connection_icon,
+};
+
+#define WIDGETS(list) list, sizeof(list) / sizeof(list[0])
+#define NO_WIDGETS NULL, 0
+
+// The home screen owns the status widgets, so it must stay SCREEN_KEEP
+static const screen_entry_t screens[UI_SCREEN_MAX] = {
+    [UI_SCREEN_SPLASH] = { "splash", &ui_splash_screen, ui_splash_screen_screen_init,
+                           WIDGETS(splash_widgets), NO_WIDGETS, NO_WIDGETS, false, SCREEN_SHOW_ONCE, false },
+    [UI_SCREEN_HOME] = { "home", &ui_home_screen, ui_home_screen_screen_init,
+                         WIDGETS(home_widgets), WIDGETS(home_static), WIDGETS(home_status), true, SCREEN_KEEP, true },
+    [UI_SCREEN_DETAILED] = { "detailed", &ui_detailed_home, ui_detailed_home_screen_init,
+                             WIDGETS(detailed_widgets), WIDGETS(detailed_static), NO_WIDGETS, true, SCREEN_KEEP, true },
+#if SCREEN_MANAGER_FREE_RARE_SCREENS
+    [UI_SCREEN_SHUTDOWN] = { "shutdown", &ui_shutdown_screen, ui_shutdown_screen_screen_init,
+                             WIDGETS(shutdown_widgets), NO_WIDGETS, NO_WIDGETS, true, SCREEN_FREE_ON_LEAVE, false },
+#else
+    [UI_SCREEN_SHUTDOWN] = { "shutdown", &ui_shutdown_screen, ui_shutdown_screen_screen_init,
+                             WIDGETS(shutdown_widgets), NO_WIDGETS, NO_WIDGETS, true, SCREEN_KEEP, false },
+#endif
+    // Full screen for the task table, freed so the sampler stops with it
+    [UI_SCREEN_DIAGNOSTICS] = { "diagnostics", &diag_screen, diag_screen_init,
+                                NO_WIDGETS, NO_WIDGETS, NO_WIDGETS, false, SCREEN_FREE_ON_LEAVE, false },
+};
+
+static ui_screen_t active_screen = UI_SCREEN_MAX;
+
+static size_t lvgl_heap_used(void) {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+static void destroy_screen(ui_screen_t id) {
+    const screen_entry_t *entry = &screens[id];
+
+    if (*entry->screen == NULL) {
+        return;
+    }
+
+    lv_obj_del(*entry->screen);
+    *entry->screen = NULL;
+    for (size_t i = 0; i < entry->widget_count; i++) {
+        *entry->widgets[i] = NULL;
+    }
+}
+
+void screen_manager_init(void) {
+    // Same theme as the SquareLine generated ui_init()
+    lv_disp_t *dispp = lv_disp_get_default();
+    lv_theme_t *theme = lv_theme_default_init(dispp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED),
+                                              true, LV_FONT_DEFAULT);
+    lv_disp_set_theme(dispp, theme);
+
+    // Packed splash images need their decoder before the first screen is built
+    img_rle_init();
+#if IMG_RLE_BENCHMARK
+    img_rle_benchmark();
+#endif
+
+    status_bar_init();
+}
+
+void screen_manager_load(ui_screen_t id) {
+    if (id >= UI_SCREEN_MAX) {
+        ESP_LOGW(TAG, "Invalid screen %d", id);
+        return;
+    }
+    if (id == active_screen) {
+        return;
+    }
+
+    const screen_entry_t *entry = &screens[id];
+    size_t used_before = lvgl_heap_used();
+
+    bool built = false;
+    if (*entry->screen == NULL) {
+        entry->init();
+        if (entry->status_bar) {
+            status_bar_fit_screen(*entry->screen);
+        }
+        status_bar_adopt(entry->status_widgets, entry->status_count);
+        static_layer_capture(entry->static_widgets, entry->static_count);
+        built = true;
+    }
+#if LCD_FLUSH_STATS
+    uint32_t flushed_before = lcd_get_flushed_pixels();
+#endif
+    lv_disp_load_scr(*entry->screen);
+    status_bar_set_visible(entry->status_bar);
+
+    // Both screens are alive at this point, which is the peak of the transition
+    size_t used_peak = lvgl_heap_used();
+
+    ui_screen_t previous = active_screen;
+    active_screen = id;
+    if (entry->resume) {
+        resume_set_screen(id);
+    }
+    if (previous != UI_SCREEN_MAX && screens[previous].policy != SCREEN_KEEP) {
+        destroy_screen(previous);
+    }
+
+#if SCREEN_MANAGER_MEM_STATS
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    ESP_LOGI(TAG, "%s -> %s: LVGL heap %u -> peak %u -> steady %u of %lu bytes (max %lu, frag %u%%)",
+             previous != UI_SCREEN_MAX ? screens[previous].name : "none", entry->name,
+             (unsigned)used_before, (unsigned)used_peak, (unsigned)(mon.total_size - mon.free_size),
+             (unsigned long)mon.total_size, (unsigned long)mon.max_used, mon.frag_pct);
+#else
+    (void)used_before;
+    (void)used_peak;
+#endif
+
+#if LCD_FLUSH_STATS
+    // Render the switch now so no other update is counted with it
+    lv_refr_now(NULL);
+    uint32_t flushed = lcd_get_flushed_pixels() - flushed_before;
+    uint32_t display = lv_disp_get_hor_res(NULL) * lv_disp_get_ver_res(NULL);
+    ESP_LOGI(TAG, "-> %s: %lu pixels flushed, %lu%% of the display", entry->name, (unsigned long)flushed,
+             (unsigned long)(flushed * 100 / display));
+#endif
+
+#if STATIC_LAYER_BENCHMARK
+    if (built && entry->static_count > 0) {
+        static_layer_benchmark(*entry->screen);
+    }
+#else
+    (void)built;
+#endif
+}
+
+ui_screen_t screen_manager_get_active(void) {
+    return active_screen;
+}
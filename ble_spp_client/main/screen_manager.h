@@ -0,0 +1,24 @@
+#ifndef SCREEN_MANAGER_H
+#define SCREEN_MANAGER_H
+
+#include <stdbool.h>
+#include "lvgl.h"
+#include "ui_screen.h"
+
+// Free rarely used screens (shutdown) as soon as they go out of view
+#define SCREEN_MANAGER_FREE_RARE_SCREENS 1
+
+// Log LVGL heap usage on every screen transition
+#define SCREEN_MANAGER_MEM_STATS 0
+
+// Set up the theme. Replaces ui_init(), screens are built on first use.
+void screen_manager_init(void);
+
+// Build the screen if needed, show it and tear down the previous one
+// if its policy says so. LVGL task only once it is running.
+void screen_manager_load(ui_screen_t screen);
+
+// Currently shown screen
+ui_screen_t screen_manager_get_active(void);
+
+#endif // SCREEN_MANAGER_H
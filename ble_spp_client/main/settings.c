@@ -0,0 +1,282 @@
+#include "settings.h"
+#include <stddef.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+#include "nvs.h"
+#include "adc.h"
+#include "executor.h"
+#include "resume.h"
+
+#define TAG "SETTINGS"
+
+// Namespaces and keys of firmware before the blob, read once to migrate
+#define LEGACY_VESC_NAMESPACE "vesc_cfg"
+#define LEGACY_KEY_MOTOR_PULLEY "mot_pulley"
+#define LEGACY_KEY_WHEEL_PULLEY "wheel_pulley"
+#define LEGACY_KEY_WHEEL_DIAM "wheel_diam"
+#define LEGACY_KEY_MOTOR_POLES "motor_poles"
+#define LEGACY_KEY_INV_THROT "inv_throttle"
+#define LEGACY_ADC_NAMESPACE "adc_cal"
+#define LEGACY_KEY_ADC_MIN "min_val"
+#define LEGACY_KEY_ADC_MAX "max_val"
+#define LEGACY_KEY_ADC_CALIBRATED "cal_done"
+
+typedef struct {
+    uint16_t version;
+    uint16_t size;       // sizeof(settings_t) of that version
+    settings_t settings;
+    uint32_t crc;        // Over everything before it
+} stored_t;
+
+static const settings_t defaults = {
+    .vesc = {
+        .motor_pulley = 15,        // 15T motor pulley
+        .wheel_pulley = 36,        // 36T wheel pulley
+        .wheel_diameter_mm = 83,   // 83mm wheels
+        .motor_poles = 14,         // 14 pole motor
+        .invert_throttle = false   // Normal throttle direction
+    },
+    .adc_calibrated = false,
+    .adc_min = ADC_INITIAL_MIN_VALUE,
+    .adc_max = ADC_INITIAL_MAX_VALUE,
+};
+
+static SemaphoreHandle_t mutex = NULL;  // current and dirty
+static settings_t current;
+static bool dirty = false;
+static uint32_t pending_changes;  // Coalesced into the next write
+static esp_timer_handle_t save_timer = NULL;
+
+static uint32_t stored_crc(const stored_t *stored) {
+    return esp_rom_crc32_le(0, (const uint8_t *)stored, offsetof(stored_t, crc));
+}
+
+// Mutex held
+static esp_err_t save(void) {
+    nvs_handle_t nvs;
+    stored_t stored = {
+        .version = SETTINGS_VERSION,
+        .size = sizeof(settings_t),
+        .settings = current,
+    };
+
+    if (!dirty) {
+        return ESP_OK;
+    }
+    stored.crc = stored_crc(&stored);
+
+    esp_err_t ret = nvs_open(SETTINGS_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = nvs_set_blob(nvs, SETTINGS_NVS_KEY, &stored, sizeof(stored));
+    if (ret == ESP_OK) {
+        ret = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Saved, %lu change(s) in one write", (unsigned long)pending_changes);
+        dirty = false;
+        pending_changes = 0;
+    }
+    return ret;
+}
+
+static void save_work(void *arg) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    esp_err_t ret = save();
+    xSemaphoreGive(mutex);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Save failed: %s", esp_err_to_name(ret));
+    }
+}
+
+// The NVS write blocks, it is done on the background worker
+static void save_timer_cb(void *arg) {
+    if (executor_post(EXECUTOR_BACKGROUND, save_work, NULL) != ESP_OK) {
+        ESP_LOGW(TAG, "Save not queued, retried on the next change or before sleep");
+    }
+}
+
+// Mutex held. Restarts the delay, so only the last of a burst is written.
+static void changed(void) {
+    dirty = true;
+    pending_changes++;
+    resume_set_settings(&current);
+    if (save_timer != NULL) {
+        esp_timer_stop(save_timer);
+        esp_timer_start_once(save_timer, SETTINGS_SAVE_DELAY_MS * 1000ULL);
+    }
+}
+
+// Older layouts of the blob would be brought up to date here. There are
+// none yet, version 1 is the first.
+static bool migrate(const stored_t *stored, size_t len) {
+    if (len != sizeof(*stored) || stored->version != SETTINGS_VERSION || stored->size != sizeof(settings_t)) {
+        ESP_LOGW(TAG, "Unknown layout, version %u", stored->version);
+        return false;
+    }
+    current = stored->settings;
+    return true;
+}
+
+static esp_err_t load_blob(void) {
+    nvs_handle_t nvs;
+    stored_t stored;
+    size_t len = sizeof(stored);
+
+    esp_err_t ret = nvs_open(SETTINGS_NVS_NAMESPACE, NVS_READONLY, &nvs);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = nvs_get_blob(nvs, SETTINGS_NVS_KEY, &stored, &len);
+    nvs_close(nvs);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    if (len >= sizeof(stored) && stored.crc != stored_crc(&stored)) {
+        ESP_LOGE(TAG, "CRC mismatch, using defaults");
+        return ESP_ERR_INVALID_CRC;
+    }
+    return migrate(&stored, len) ? ESP_OK : ESP_ERR_INVALID_VERSION;
+}
+
+// Each legacy namespace is taken as a whole or not at all
+static bool load_legacy(void) {
+    nvs_handle_t nvs;
+    bool found = false;
+
+    if (nvs_open(LEGACY_VESC_NAMESPACE, NVS_READONLY, &nvs) == ESP_OK) {
+        vesc_config_t vesc;
+        uint8_t invert;
+        if (nvs_get_u8(nvs, LEGACY_KEY_MOTOR_PULLEY, &vesc.motor_pulley) == ESP_OK &&
+            nvs_get_u8(nvs, LEGACY_KEY_WHEEL_PULLEY, &vesc.wheel_pulley) == ESP_OK &&
+            nvs_get_u8(nvs, LEGACY_KEY_WHEEL_DIAM, &vesc.wheel_diameter_mm) == ESP_OK &&
+            nvs_get_u8(nvs, LEGACY_KEY_MOTOR_POLES, &vesc.motor_poles) == ESP_OK &&
+            nvs_get_u8(nvs, LEGACY_KEY_INV_THROT, &invert) == ESP_OK) {
+            vesc.invert_throttle = invert != 0;
+            current.vesc = vesc;
+            found = true;
+        }
+        nvs_close(nvs);
+    }
+
+    if (nvs_open(LEGACY_ADC_NAMESPACE, NVS_READONLY, &nvs) == ESP_OK) {
+        uint8_t calibrated;
+        uint32_t min;
+        uint32_t max;
+        if (nvs_get_u8(nvs, LEGACY_KEY_ADC_CALIBRATED, &calibrated) == ESP_OK && calibrated &&
+            nvs_get_u32(nvs, LEGACY_KEY_ADC_MIN, &min) == ESP_OK &&
+            nvs_get_u32(nvs, LEGACY_KEY_ADC_MAX, &max) == ESP_OK) {
+            current.adc_calibrated = true;
+            current.adc_min = min;
+            current.adc_max = max;
+            found = true;
+        }
+        nvs_close(nvs);
+    }
+    return found;
+}
+
+static void erase_legacy(void) {
+    static const char *const namespaces[] = { LEGACY_VESC_NAMESPACE, LEGACY_ADC_NAMESPACE };
+    nvs_handle_t nvs;
+
+    for (size_t i = 0; i < sizeof(namespaces) / sizeof(namespaces[0]); i++) {
+        if (nvs_open(namespaces[i], NVS_READWRITE, &nvs) == ESP_OK) {
+            nvs_erase_all(nvs);
+            nvs_commit(nvs);
+            nvs_close(nvs);
+        }
+    }
+}
+
+esp_err_t settings_init(void) {
+    int64_t start = esp_timer_get_time();
+
+    if (mutex != NULL) {
+        return ESP_OK;
+    }
+    mutex = xSemaphoreCreateMutex();
+    if (mutex == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    const esp_timer_create_args_t args = {
+        .callback = save_timer_cb,
+        .name = "settings_save",
+    };
+    esp_err_t ret = esp_timer_create(&args, &save_timer);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    // Kept over deep sleep, nothing to read
+    if (resume_get_settings(&current)) {
+        ESP_LOGI(TAG, "Taken from RTC memory");
+        return ESP_OK;
+    }
+
+    current = defaults;
+    ret = load_blob();
+    if (ret == ESP_ERR_NVS_NOT_FOUND && load_legacy()) {
+        // One write for the blob, the old keys go once it is in
+        ESP_LOGI(TAG, "Migrating the per key settings");
+        dirty = true;
+        pending_changes = 1;
+        if (save() == ESP_OK) {
+            erase_legacy();
+        }
+    } else if (ret != ESP_OK) {
+        ESP_LOGI(TAG, "No usable settings (%s), using defaults", esp_err_to_name(ret));
+    }
+    resume_set_settings(&current);
+
+    ESP_LOGI(TAG, "Loaded in %lld us", esp_timer_get_time() - start);
+    return ESP_OK;
+}
+
+void settings_get(settings_t *settings) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    *settings = current;
+    xSemaphoreGive(mutex);
+}
+
+void settings_set_vesc(const vesc_config_t *vesc) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (memcmp(&current.vesc, vesc, sizeof(*vesc)) != 0) {
+        current.vesc = *vesc;
+        changed();
+    }
+    xSemaphoreGive(mutex);
+}
+
+void settings_set_adc_calibration(uint32_t min, uint32_t max) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (!current.adc_calibrated || current.adc_min != min || current.adc_max != max) {
+        current.adc_calibrated = true;
+        current.adc_min = min;
+        current.adc_max = max;
+        changed();
+    }
+    xSemaphoreGive(mutex);
+}
+
+void settings_flush(void) {
+    if (mutex == NULL) {
+        return;
+    }
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    esp_timer_stop(save_timer);
+    esp_err_t ret = save();
+    xSemaphoreGive(mutex);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Save failed: %s", esp_err_to_name(ret));
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "vesc_config.h"
+
+// Everything the remote keeps in NVS, one versioned blob with a CRC. It is
+// read once at boot (or taken from RTC memory after a deep sleep wake) and
+// served from RAM. Changes are written back SETTINGS_SAVE_DELAY_MS after
+// the last one, so a burst of edits costs one write.
+#define SETTINGS_NVS_NAMESPACE "settings"
+#define SETTINGS_NVS_KEY "blob"
+
+// Bump when settings_t changes and add the step to migrate() in settings.c
+#define SETTINGS_VERSION 1
+
+#define SETTINGS_SAVE_DELAY_MS 2000
+
+typedef struct {
+    vesc_config_t vesc;
+    bool adc_calibrated;
+    uint32_t adc_min;
+    uint32_t adc_max;
+} settings_t;
+
+// Load the blob, or migrate the per key namespaces of older firmware into
+// it. Right after nvs_flash_init(), before anything reads settings.
+esp_err_t settings_init(void);
+
+// Copy of the settings in use. Any task.
+void settings_get(settings_t *settings);
+
+// Change a part of the settings, written to NVS later. Any task.
+void settings_set_vesc(const vesc_config_t *vesc);
+void settings_set_adc_calibration(uint32_t min, uint32_t max);
+
+// Write a pending change now, before deep sleep. Any task.
+void settings_flush(void);
+
+#endif // SETTINGS_H
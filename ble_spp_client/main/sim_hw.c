@@ -0,0 +1,346 @@
+#include "sim_hw.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+#include "hal/adc_types.h"
+#include "adc.h"
+#include "lcd.h"
+#include "sim_hw_script.h"
+
+#define TAG "SIM_HW"
+#define LINE_LEN 128
+
+// Embedded by main/CMakeLists.txt
+extern const char script_start[] asm("_binary_sim_hw_script_txt_start");
+extern const char script_end[] asm("_binary_sim_hw_script_txt_end");
+
+typedef struct {
+    TaskHandle_t handle;
+    uint32_t runtime;
+} task_mark_t;
+
+static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Lever, under lock. Read by the ADC on the control worker.
+static sim_hw_lever_t lever;
+static volatile int32_t battery = SIM_HW_BATTERY_DEFAULT;
+
+static volatile bool pressed;
+static void (*button_isr)(void *arg);
+
+// Panel. The script task takes the mutex to read a whole frame.
+static SemaphoreHandle_t framebuffer_mutex;
+static uint16_t *framebuffer;
+static volatile uint32_t backlight;
+
+// Current section, under lock
+static int64_t section_start_us;
+static int32_t step_raw;
+static int64_t step_us;
+static bool step_pending;       // Stepped, the mapped value is not sent yet
+static uint32_t latencies_ms[SIM_HW_MAX_STEPS];
+static size_t latency_count;
+static uint32_t superseded;     // Stepped again before the value was sent
+static uint32_t sends;
+static uint32_t flushes;
+static uint64_t flushed_px;
+
+// Script task only
+static char label[SIM_HW_LABEL_LEN];
+static TaskStatus_t task_status[SIM_HW_MAX_TASKS];
+static task_mark_t marks[SIM_HW_MAX_TASKS];
+static size_t mark_count;
+static uint32_t mark_total;
+
+int32_t sim_hw_adc_read(int channel) {
+    int64_t now_us = esp_timer_get_time();
+    int32_t value;
+
+    if (channel == BATTERY_PIN) {
+        return battery;
+    }
+    if (channel != THROTTLE_PIN) {
+        return -1;
+    }
+
+    taskENTER_CRITICAL(&lock);
+    value = sim_hw_lever_read(&lever, now_us);
+    taskEXIT_CRITICAL(&lock);
+    return value;
+}
+
+static void move_lever(int32_t raw, uint32_t over_ms) {
+    int64_t now_us = esp_timer_get_time();
+
+    taskENTER_CRITICAL(&lock);
+    sim_hw_lever_move(&lever, raw, over_ms, now_us);
+    // Latency is taken for steps only, a ramp has no single moment
+    if (step_pending) {
+        superseded++;
+    }
+    step_pending = over_ms == 0;
+    step_raw = raw;
+    step_us = now_us;
+    taskEXIT_CRITICAL(&lock);
+}
+
+bool sim_hw_button_pressed(void) {
+    return pressed;
+}
+
+void sim_hw_button_set_isr(void (*isr)(void *arg)) {
+    button_isr = isr;
+}
+
+static void set_button(bool level) {
+    pressed = level;
+    if (button_isr != NULL) {
+        button_isr(NULL);
+    }
+}
+
+void sim_hw_flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2, const uint16_t *pixels) {
+    size_t width = (size_t)(x2 - x1 + 1);
+
+    if (framebuffer != NULL) {
+        xSemaphoreTake(framebuffer_mutex, portMAX_DELAY);
+        for (int32_t y = y1; y <= y2; y++) {
+            memcpy(&framebuffer[y * LV_HOR_RES_MAX + x1], &pixels[(y - y1) * width], width * sizeof(uint16_t));
+        }
+        xSemaphoreGive(framebuffer_mutex);
+    }
+
+    taskENTER_CRITICAL(&lock);
+    flushes++;
+    flushed_px += width * (size_t)(y2 - y1 + 1);
+    taskEXIT_CRITICAL(&lock);
+}
+
+void sim_hw_backlight(uint32_t duty) {
+    backlight = duty;
+}
+
+void sim_hw_throttle_sent(uint32_t value) {
+    int64_t now_us = esp_timer_get_time();
+
+    taskENTER_CRITICAL(&lock);
+    sends++;
+    bool pending = step_pending;
+    int32_t raw = step_raw;
+    int32_t tolerance = lever.noise > 0 ? 1 : 0;
+    taskEXIT_CRITICAL(&lock);
+
+    // Mapped with the calibration in use, as adc_sample_throttle() does
+    if (!pending || abs((int32_t)map_adc_value(raw) - (int32_t)value) > tolerance) {
+        return;
+    }
+    taskENTER_CRITICAL(&lock);
+    if (step_pending && step_raw == raw) {
+        step_pending = false;
+        if (latency_count < SIM_HW_MAX_STEPS) {
+            latencies_ms[latency_count++] = (uint32_t)((now_us - step_us) / 1000);
+        }
+    }
+    taskEXIT_CRITICAL(&lock);
+}
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static uint32_t mark_runtime_of(TaskHandle_t handle, bool *found) {
+    for (size_t i = 0; i < mark_count; i++) {
+        if (marks[i].handle == handle) {
+            *found = true;
+            return marks[i].runtime;
+        }
+    }
+    *found = false;
+    return 0;
+}
+
+static void remember_tasks(size_t count, uint32_t total) {
+    for (size_t i = 0; i < count; i++) {
+        marks[i].handle = task_status[i].xHandle;
+        marks[i].runtime = task_status[i].ulRunTimeCounter;
+    }
+    mark_count = count;
+    mark_total = total;
+}
+
+// Run time since the section started, for every task alive at its end.
+// The counter is esp_timer microseconds, see CONFIG_FREERTOS_RUN_TIME_STATS_USING_ESP_TIMER.
+static void print_tasks(void) {
+    uint32_t total;
+    size_t count = uxTaskGetSystemState(task_status, SIM_HW_MAX_TASKS, &total);
+    uint32_t total_delta = total - mark_total;
+
+    if (count == 0) {
+        ESP_LOGW(TAG, "More than %d tasks, raise SIM_HW_MAX_TASKS", SIM_HW_MAX_TASKS);
+    }
+    for (size_t i = 0; i < count; i++) {
+        const TaskStatus_t *t = &task_status[i];
+        bool found;
+        uint32_t run = t->ulRunTimeCounter - mark_runtime_of(t->xHandle, &found);
+        if (!found) {
+            // Started during the section
+            run = t->ulRunTimeCounter;
+        }
+        uint32_t pct10 = total_delta > 0 ? (uint32_t)((uint64_t)run * 1000 / total_delta) : 0;
+        printf(SIM_HW_PREFIX "%s task %-16s cpu %3lu.%lu%%  run ms %6lu  stack free %5lu\n", label,
+               t->pcTaskName, (unsigned long)(pct10 / 10), (unsigned long)(pct10 % 10),
+               (unsigned long)(run / 1000), (unsigned long)t->usStackHighWaterMark);
+    }
+    remember_tasks(count, total);
+}
+
+static void section_print(void) {
+    uint32_t latencies[SIM_HW_MAX_STEPS];
+    int64_t now_us = esp_timer_get_time();
+
+    taskENTER_CRITICAL(&lock);
+    size_t steps = latency_count;
+    memcpy(latencies, latencies_ms, steps * sizeof(uint32_t));
+    uint32_t section_superseded = superseded;
+    uint32_t section_sends = sends;
+    uint32_t section_flushes = flushes;
+    uint64_t section_px = flushed_px;
+    int64_t start_us = section_start_us;
+    latency_count = 0;
+    superseded = 0;
+    sends = 0;
+    flushes = 0;
+    flushed_px = 0;
+    section_start_us = now_us;
+    taskEXIT_CRITICAL(&lock);
+
+    printf(SIM_HW_PREFIX "%s %lu ms  sends %lu  flushes %lu  flushed px %llu (%lu screens)  backlight %lu\n",
+           label, (unsigned long)((now_us - start_us) / 1000), (unsigned long)section_sends,
+           (unsigned long)section_flushes, (unsigned long long)section_px,
+           (unsigned long)(section_px / (LV_HOR_RES_MAX * LV_VER_RES_MAX)), (unsigned long)backlight);
+    if (steps > 0) {
+        uint64_t total = 0;
+        for (size_t i = 0; i < steps; i++) {
+            total += latencies[i];
+        }
+        qsort(latencies, steps, sizeof(uint32_t), compare_u32);
+        printf(SIM_HW_PREFIX "%s throttle ms avg %lu p50 %lu p95 %lu max %lu (%u steps, %lu superseded)\n",
+               label, (unsigned long)(total / steps), (unsigned long)latencies[steps / 2],
+               (unsigned long)latencies[steps * 95 / 100], (unsigned long)latencies[steps - 1],
+               (unsigned)steps, (unsigned long)section_superseded);
+    }
+    print_tasks();
+}
+
+static void snap(const char *name) {
+    if (framebuffer == NULL) {
+        printf(SIM_HW_PREFIX "%s snap %s no framebuffer\n", label, name);
+        return;
+    }
+    xSemaphoreTake(framebuffer_mutex, portMAX_DELAY);
+    uint32_t crc = esp_rom_crc32_le(0, (const uint8_t *)framebuffer,
+                                    LV_HOR_RES_MAX * LV_VER_RES_MAX * sizeof(uint16_t));
+    xSemaphoreGive(framebuffer_mutex);
+    printf(SIM_HW_PREFIX "%s snap %s crc32 %08lx\n", label, name, (unsigned long)crc);
+}
+
+static bool run_line(const char *line, TickType_t *wake) {
+    sim_hw_cmd_t cmd;
+
+    if (!sim_hw_script_parse(line, &cmd)) {
+        return false;
+    }
+    switch (cmd.type) {
+        case SIM_HW_CMD_WAIT: {
+            // From the end of the last wait, the commands between take no time
+            TickType_t ticks = pdMS_TO_TICKS(cmd.value);
+            if (ticks > 0) {
+                vTaskDelayUntil(wake, ticks);
+            }
+            break;
+        }
+        case SIM_HW_CMD_THROTTLE:
+            move_lever(cmd.value, cmd.over_ms);
+            break;
+        case SIM_HW_CMD_NOISE:
+            taskENTER_CRITICAL(&lock);
+            sim_hw_lever_set_noise(&lever, cmd.value);
+            taskEXIT_CRITICAL(&lock);
+            break;
+        case SIM_HW_CMD_BATTERY:
+            battery = cmd.value;
+            break;
+        case SIM_HW_CMD_PRESS:
+        case SIM_HW_CMD_RELEASE:
+            set_button(cmd.type == SIM_HW_CMD_PRESS);
+            break;
+        case SIM_HW_CMD_SNAP:
+            snap(cmd.label);
+            break;
+        case SIM_HW_CMD_MARK:
+            section_print();
+            snprintf(label, sizeof(label), "%s", cmd.label);
+            break;
+        case SIM_HW_CMD_NONE:
+            break;
+    }
+    return true;
+}
+
+static void script_task(void *arg) {
+    char line[LINE_LEN];
+    const char *p = script_start;
+    int line_no = 0;
+    TickType_t wake = xTaskGetTickCount();
+
+    // The text is NUL terminated, the end symbol is past it
+    while (p < script_end && *p != '\0') {
+        const char *eol = memchr(p, '\n', script_end - p);
+        size_t len = eol != NULL ? (size_t)(eol - p) : strlen(p);
+        snprintf(line, sizeof(line), "%.*s", (int)len, p);
+        p += eol != NULL ? len + 1 : len;
+        line_no++;
+        if (!run_line(line, &wake)) {
+            ESP_LOGE(TAG, "Script line %d: cannot run: %s", line_no, line);
+        }
+    }
+
+    section_print();
+    printf(SIM_HW_PREFIX "done\n");
+    vTaskDelete(NULL);
+}
+
+esp_err_t sim_hw_start(void) {
+    sim_hw_lever_init(&lever);
+    framebuffer_mutex = xSemaphoreCreateMutex();
+    if (framebuffer_mutex == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    // Optional, the flushes are counted without it
+    framebuffer = heap_caps_calloc(LV_HOR_RES_MAX * LV_VER_RES_MAX, sizeof(uint16_t), MALLOC_CAP_DEFAULT);
+    if (framebuffer == NULL) {
+        ESP_LOGW(TAG, "No memory for the framebuffer, snap is off");
+    }
+
+    snprintf(label, sizeof(label), "boot");
+    section_start_us = esp_timer_get_time();
+    uint32_t total;
+    size_t count = uxTaskGetSystemState(task_status, SIM_HW_MAX_TASKS, &total);
+    remember_tasks(count, total);
+
+    if (xTaskCreate(script_task, "sim_hw", SIM_HW_STACK_SIZE, NULL, SIM_HW_PRIORITY, NULL) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Simulated throttle, button and panel, %u byte script",
+             (unsigned)(script_end - script_start));
+    return ESP_OK;
+}
@@ -0,0 +1,67 @@
+#ifndef SIM_HW_H
+#define SIM_HW_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+// Simulated throttle, button and panel, to run the firmware headless under
+// Espressif's QEMU where none of them exist:
+//     idf.py -B build-qemu -DSIM_HW=1 build
+//     idf.py -B build-qemu qemu monitor
+// The ADC reads follow a scripted waveform, the button a scripted timeline
+// and the flushes land in a framebuffer in RAM. Tasks, workers, timers and
+// LVGL are the firmware's own. The BLE controller is not started either,
+// throttle_send() hands the value to sim_hw_throttle_sent() in place of the
+// GATT write, on the same worker and period.
+//
+// The script is embedded at build time, sim/scripts/qemu.txt unless
+// -DSIM_HW_SCRIPT=<file> is given. It is played from boot, one command per
+// line, # starts a comment:
+//     wait <ms>                let time pass
+//     throttle <raw> [ms]      move the lever to this ADC value, at once or over ms
+//     noise <raw>              peak noise added to every throttle read
+//     battery <raw>            ADC value of the battery divider
+//     press / release          button edges, through the debounce of button.c
+//     snap <label>             CRC32 of the framebuffer, to compare two builds
+//     mark <label>             end the current section and start a new one
+// The parser and the lever are in sim_hw_script.c, which the host tests in
+// sim/ run against this script.
+//
+// Every section prints lines starting with SIM_HW_PREFIX: throttle latency
+// (lever stepped to the mapped value sent, each send takes its own sample),
+// frames flushed, and for each task its CPU share, run time and the
+// smallest free stack so far. Light sleep and deep sleep are not
+// part of the simulation, the script keeps the remote busy.
+#ifndef SIM_HW
+#define SIM_HW 0
+#endif
+
+#define SIM_HW_PREFIX "SIM "
+#define SIM_HW_PRIORITY 8          // Above the workers, steps land on time
+#define SIM_HW_STACK_SIZE 4096
+#define SIM_HW_MAX_STEPS 64        // Throttle latencies kept per section
+#define SIM_HW_MAX_TASKS 20
+#define SIM_HW_BATTERY_DEFAULT 2600
+
+#if SIM_HW
+// Start playing the script, before the ADC and button drivers
+esp_err_t sim_hw_start(void);
+
+// Stand-in for adc_oneshot_read(), any task
+int32_t sim_hw_adc_read(int channel);
+
+// Level of the button and the handler its edges are reported to, in place
+// of the GPIO interrupt
+bool sim_hw_button_pressed(void);
+void sim_hw_button_set_isr(void (*isr)(void *arg));
+
+// Panel stand-ins, LVGL task. Pixels are RGB565 as LVGL draws them.
+void sim_hw_flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2, const uint16_t *pixels);
+void sim_hw_backlight(uint32_t duty);
+
+// Throttle value that would have been written to the controller, control worker
+void sim_hw_throttle_sent(uint32_t value);
+#endif
+
+#endif // SIM_HW_H
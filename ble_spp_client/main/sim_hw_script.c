@@ -0,0 +1,84 @@
+#include "sim_hw_script.h"
+#include <stdio.h>
+#include <string.h>
+
+bool sim_hw_script_parse(const char *line, sim_hw_cmd_t *cmd) {
+    char name[16];
+    long value;
+    long extra;
+
+    memset(cmd, 0, sizeof(*cmd));
+    if (sscanf(line, "%15s", name) != 1 || name[0] == '#') {
+        cmd->type = SIM_HW_CMD_NONE;
+        return true;
+    }
+
+    int args = sscanf(line, "%*s %ld %ld", &value, &extra);
+    if (strcmp(name, "wait") == 0 && args == 1 && value >= 0) {
+        cmd->type = SIM_HW_CMD_WAIT;
+    } else if (strcmp(name, "throttle") == 0 && args >= 1 && value >= 0 && value <= SIM_HW_ADC_MAX_RAW) {
+        cmd->type = SIM_HW_CMD_THROTTLE;
+        if (args == 2) {
+            if (extra < 0) {
+                return false;
+            }
+            cmd->over_ms = (uint32_t)extra;
+        }
+    } else if (strcmp(name, "noise") == 0 && args == 1 && value >= 0 && value <= SIM_HW_ADC_MAX_RAW) {
+        cmd->type = SIM_HW_CMD_NOISE;
+    } else if (strcmp(name, "battery") == 0 && args == 1 && value >= 0 && value <= SIM_HW_ADC_MAX_RAW) {
+        cmd->type = SIM_HW_CMD_BATTERY;
+    } else if (strcmp(name, "press") == 0 && args <= 0) {
+        cmd->type = SIM_HW_CMD_PRESS;
+    } else if (strcmp(name, "release") == 0 && args <= 0) {
+        cmd->type = SIM_HW_CMD_RELEASE;
+    } else if ((strcmp(name, "snap") == 0 || strcmp(name, "mark") == 0) &&
+               sscanf(line, "%*s %31s", cmd->label) == 1) {
+        cmd->type = name[0] == 's' ? SIM_HW_CMD_SNAP : SIM_HW_CMD_MARK;
+    } else {
+        return false;
+    }
+    if (cmd->type != SIM_HW_CMD_SNAP && cmd->type != SIM_HW_CMD_MARK) {
+        cmd->value = args >= 1 ? (int32_t)value : 0;
+    }
+    return true;
+}
+
+void sim_hw_lever_init(sim_hw_lever_t *lever) {
+    memset(lever, 0, sizeof(*lever));
+    lever->noise_state = 1;
+}
+
+void sim_hw_lever_move(sim_hw_lever_t *lever, int32_t raw, uint32_t over_ms, int64_t now_us) {
+    lever->from = sim_hw_lever_position(lever, now_us);
+    lever->to = raw;
+    lever->start_us = now_us;
+    lever->ramp_us = (int64_t)over_ms * 1000;
+}
+
+void sim_hw_lever_set_noise(sim_hw_lever_t *lever, int32_t noise) {
+    lever->noise = noise;
+}
+
+int32_t sim_hw_lever_position(const sim_hw_lever_t *lever, int64_t now_us) {
+    if (lever->ramp_us == 0 || now_us >= lever->start_us + lever->ramp_us) {
+        return lever->to;
+    }
+    if (now_us <= lever->start_us) {
+        return lever->from;
+    }
+    return lever->from + (int32_t)((lever->to - lever->from) * (now_us - lever->start_us) / lever->ramp_us);
+}
+
+int32_t sim_hw_lever_read(sim_hw_lever_t *lever, int64_t now_us) {
+    int32_t value = sim_hw_lever_position(lever, now_us);
+
+    if (lever->noise > 0) {
+        lever->noise_state = lever->noise_state * 1103515245u + 12345u;
+        value += (int32_t)((lever->noise_state >> 16) % (uint32_t)(2 * lever->noise + 1)) - lever->noise;
+    }
+    if (value < 0) {
+        return 0;
+    }
+    return value > SIM_HW_ADC_MAX_RAW ? SIM_HW_ADC_MAX_RAW : value;
+}
@@ -0,0 +1,62 @@
+#ifndef SIM_HW_SCRIPT_H
+#define SIM_HW_SCRIPT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Script lines and the throttle lever of the simulated build, see sim_hw.h.
+// It has no hardware or RTOS dependencies, sim_hw.c plays the commands and
+// reads the lever with the esp_timer time, the host tests check the script
+// and the waveforms.
+
+#define SIM_HW_ADC_MAX_RAW 4095
+#define SIM_HW_LABEL_LEN 32
+
+typedef enum {
+    SIM_HW_CMD_NONE,      // Blank line or comment
+    SIM_HW_CMD_WAIT,      // value ms
+    SIM_HW_CMD_THROTTLE,  // value raw, over_ms 0 for a step
+    SIM_HW_CMD_NOISE,     // value raw
+    SIM_HW_CMD_BATTERY,   // value raw
+    SIM_HW_CMD_PRESS,
+    SIM_HW_CMD_RELEASE,
+    SIM_HW_CMD_SNAP,      // label
+    SIM_HW_CMD_MARK,      // label
+} sim_hw_cmd_type_t;
+
+typedef struct {
+    sim_hw_cmd_type_t type;
+    int32_t value;
+    uint32_t over_ms;
+    char label[SIM_HW_LABEL_LEN];
+} sim_hw_cmd_t;
+
+// False for a line that is not a command or is out of range
+bool sim_hw_script_parse(const char *line, sim_hw_cmd_t *cmd);
+
+typedef struct {
+    int32_t from;
+    int32_t to;
+    int64_t start_us;
+    int64_t ramp_us;  // 0 after a step
+    int32_t noise;
+    uint32_t noise_state;
+} sim_hw_lever_t;
+
+// At rest on raw 0, no noise
+void sim_hw_lever_init(sim_hw_lever_t *lever);
+
+// Move from wherever the lever is now, at once or over over_ms
+void sim_hw_lever_move(sim_hw_lever_t *lever, int32_t raw, uint32_t over_ms, int64_t now_us);
+
+// Peak noise added to every read
+void sim_hw_lever_set_noise(sim_hw_lever_t *lever, int32_t noise);
+
+// Position without the noise
+int32_t sim_hw_lever_position(const sim_hw_lever_t *lever, int64_t now_us);
+
+// One ADC read: the position plus noise, clamped to the ADC range. The
+// noise is the same sequence on every run.
+int32_t sim_hw_lever_read(sim_hw_lever_t *lever, int64_t now_us);
+
+#endif // SIM_HW_SCRIPT_H
@@ -6,13 +6,26 @@
 #include "ui/ui.h"
 #include "lvgl.h"
 #include "esp_sleep.h"
+#include "executor.h"
+#include "ui_cmd.h"
+#include "ble_spp_client.h"
+#include "resume.h"
+#include "ride_log.h"
+#include "trip.h"
+#include "settings.h"
+#include "inactivity.h"
 
 #define TAG "SLEEP"
 
-static TickType_t last_activity_time;
-static TickType_t last_reset_time = 0;
+static inactivity_t inactivity;
 #define RESET_DEBOUNCE_TIME_MS 2000
 
+// Wraps with the tick count, the differences stay right
+static uint32_t now_ms(void)
+{
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
 static lv_anim_t arc_anim;
 static bool arc_animation_active = false;
 
@@ -26,10 +39,43 @@ static void set_bar_value(void * obj, int32_t v)
         ESP_ERROR_CHECK(esp_deep_sleep_enable_gpio_wakeup(1ULL << MAIN_BUTTON_GPIO,
                                                       ESP_GPIO_WAKEUP_GPIO_LOW));
         vTaskDelay(pdMS_TO_TICKS(2000));
+        ride_log_flush();
+        trip_flush();
+        settings_flush();
+        resume_prepare_sleep();
         esp_deep_sleep_start();
     }
 }
 
+void sleep_start_shutdown_animation(void)
+{
+    if (arc_animation_active) {
+        return;
+    }
+
+    // Start bar animation
+    lv_anim_init(&arc_anim);
+    lv_anim_set_var(&arc_anim, ui_Bar4);
+    lv_anim_set_exec_cb(&arc_anim, set_bar_value);
+    lv_anim_set_time(&arc_anim, 2000);  // 2 seconds to fill
+    lv_anim_set_values(&arc_anim, 0, 100);
+    lv_anim_start(&arc_anim);
+    arc_animation_active = true;
+}
+
+bool sleep_cancel_shutdown_animation(void)
+{
+    if (!arc_animation_active) {
+        return false;
+    }
+
+    // If released before full, cancel sleep
+    lv_anim_del(ui_Bar4, set_bar_value);
+    lv_bar_set_value(ui_Bar4, 0, LV_ANIM_OFF);
+    arc_animation_active = false;
+    return true;
+}
+
 static void sleep_button_callback(button_event_t event, void* user_data) {
     static bool long_press_triggered = false;
 
@@ -39,34 +85,19 @@ static void sleep_button_callback(button_event_t event, void* user_data) {
             break;
 
         case BUTTON_EVENT_RELEASED:
-            if (arc_animation_active) {
-                // If released before full, cancel sleep
-                lv_anim_del(ui_Bar4, set_bar_value);
-                lv_bar_set_value(ui_Bar4, 0, LV_ANIM_OFF);
-                arc_animation_active = false;
-                lv_disp_load_scr(ui_home_screen);
-            }
+            // The LVGL task ignores this when no shutdown is in progress
+            ui_cmd_simple(UI_CMD_CANCEL_SHUTDOWN);
             long_press_triggered = false;
             break;
 
         case BUTTON_EVENT_LONG_PRESS:
             if (!long_press_triggered) {
                 long_press_triggered = true;
-                // Switch to shutdown screen
-                lv_disp_load_scr(ui_shutdown_screen);
-                
-                // Start bar animation
-                lv_anim_init(&arc_anim);
-                lv_anim_set_var(&arc_anim, ui_Bar4);
-                lv_anim_set_exec_cb(&arc_anim, set_bar_value);
-                lv_anim_set_time(&arc_anim, 2000);  // 2 seconds to fill
-                lv_anim_set_values(&arc_anim, 0, 100);
-                lv_anim_start(&arc_anim);
-                arc_animation_active = true;
+                ui_cmd_simple(UI_CMD_START_SHUTDOWN);
             }
             break;
 
-        case BUTTON_EVENT_DOUBLE_PRESS:
+        default:
             break;
     }
 }
@@ -83,39 +114,44 @@ void sleep_init(void) {
     button_register_callback(sleep_button_callback, NULL);
 
     ESP_ERROR_CHECK(esp_sleep_enable_gpio_wakeup());
-    last_activity_time = xTaskGetTickCount();
+    inactivity_init(&inactivity, INACTIVITY_TIMEOUT_MS, RESET_DEBOUNCE_TIME_MS, now_ms());
+}
+
+static void inactivity_check(void *arg)
+{
+    sleep_check_inactivity(is_connect);
 }
 
 void sleep_start_monitoring(void) {
     button_start_monitoring();
+
+    // A scheduled job, no task has to wake up for it in between
+    ESP_ERROR_CHECK(executor_every(EXECUTOR_BACKGROUND, INACTIVITY_CHECK_PERIOD_MS, inactivity_check, NULL));
 }
 
 void sleep_reset_inactivity_timer(void)
 {
-    TickType_t current_time = xTaskGetTickCount();
-
-    // Only reset if enough time has passed since last reset
-    if ((current_time - last_reset_time) * portTICK_PERIOD_MS >= RESET_DEBOUNCE_TIME_MS) {
-        last_activity_time = current_time;
-        last_reset_time = current_time;
-    }
+    inactivity_reset(&inactivity, now_ms());
 }
 
 void sleep_check_inactivity(bool is_ble_connected)
 {
-    TickType_t current_time = xTaskGetTickCount();
-    TickType_t elapsed_time = (current_time - last_activity_time) * portTICK_PERIOD_MS;
+    uint32_t now = now_ms();
 
     // Check if we should go to sleep (if inactive and not connected)
-    if (elapsed_time > INACTIVITY_TIMEOUT_MS && !is_ble_connected) {
+    if (inactivity_expired(&inactivity, now, is_ble_connected)) {
         ESP_LOGI(TAG, "System inactive for %lu ms and no BLE connection. Entering deep sleep.",
-                 elapsed_time);
+                 inactivity_elapsed(&inactivity, now));
 
         // Configure wakeup on button press (transition from HIGH to LOW)
         ESP_ERROR_CHECK(esp_deep_sleep_enable_gpio_wakeup(1ULL << MAIN_BUTTON_GPIO,
                                                       ESP_GPIO_WAKEUP_GPIO_LOW));
 
-        // Enter deep sleep
+        // Enter deep sleep, a button wake picks up from the retained state
+        ride_log_flush();
+        trip_flush();
+        settings_flush();
+        resume_prepare_sleep();
         esp_deep_sleep_start();
     }
 }
\ No newline at end of file
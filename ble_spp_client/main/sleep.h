@@ -6,10 +6,16 @@
 #include "button.h"
 
 #define INACTIVITY_TIMEOUT_MS 120000  // 120 seconds
+#define INACTIVITY_CHECK_PERIOD_MS 1000
 
 void sleep_init(void);
+// Arms the button and schedules the inactivity check
 void sleep_start_monitoring(void);
 void sleep_reset_inactivity_timer(void);
 void sleep_check_inactivity(bool is_ble_connected);
 
+// Shutdown screen animation, LVGL task only (requested through ui_cmd)
+void sleep_start_shutdown_animation(void);
+bool sleep_cancel_shutdown_animation(void);
+
 #endif // SLEEP_H
\ No newline at end of file
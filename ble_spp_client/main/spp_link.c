@@ -0,0 +1,143 @@
+#include "spp_link.h"
+
+void spp_link_init(spp_link_t *link, size_t subscriptions, bool have_peer) {
+    link->state = SPP_LINK_IDLE;
+    link->subscriptions = subscriptions;
+    link->step = 0;
+    link->have_peer = have_peer;
+    link->direct = false;
+}
+
+static spp_link_action_t start_scan(spp_link_t *link) {
+    link->state = SPP_LINK_SCANNING;
+    link->direct = false;
+    return SPP_LINK_ACT_START_SCAN;
+}
+
+static spp_link_action_t subscribe(spp_link_t *link) {
+    if (link->step == link->subscriptions) {
+        link->state = SPP_LINK_READY;
+        return SPP_LINK_ACT_NONE;
+    }
+    link->state = SPP_LINK_REGISTERING;
+    return SPP_LINK_ACT_REGISTER_NOTIFY;
+}
+
+spp_link_action_t spp_link_scan_params_set(spp_link_t *link) {
+    if (link->state != SPP_LINK_IDLE) {
+        return SPP_LINK_ACT_NONE;
+    }
+    if (link->have_peer) {
+        // Scanning takes over if it does not answer
+        link->state = SPP_LINK_OPENING;
+        link->direct = true;
+        return SPP_LINK_ACT_OPEN_PEER;
+    }
+    return start_scan(link);
+}
+
+// Advertisements keep coming until the scan has stopped
+spp_link_action_t spp_link_found(spp_link_t *link) {
+    if (link->state != SPP_LINK_SCANNING) {
+        return SPP_LINK_ACT_NONE;
+    }
+    link->state = SPP_LINK_STOPPING_SCAN;
+    return SPP_LINK_ACT_STOP_SCAN;
+}
+
+spp_link_action_t spp_link_scan_stopped(spp_link_t *link) {
+    if (link->state != SPP_LINK_STOPPING_SCAN) {
+        return SPP_LINK_ACT_NONE;
+    }
+    link->state = SPP_LINK_OPENING;
+    return SPP_LINK_ACT_OPEN_FOUND;
+}
+
+spp_link_action_t spp_link_open_failed(spp_link_t *link) {
+    if (link->state != SPP_LINK_OPENING) {
+        return SPP_LINK_ACT_NONE;
+    }
+    if (link->direct) {
+        link->have_peer = false;
+        start_scan(link);
+        return SPP_LINK_ACT_FORGET_PEER;
+    }
+    return start_scan(link);
+}
+
+spp_link_action_t spp_link_connected(spp_link_t *link) {
+    if (link->state != SPP_LINK_OPENING) {
+        return SPP_LINK_ACT_NONE;
+    }
+    link->step = 0;
+    if (link->direct) {
+        // Same controller as before deep sleep, no discovery if its table is kept
+        link->state = SPP_LINK_ATTRS;
+        return SPP_LINK_ACT_RESTORE_ATTRS;
+    }
+    link->state = SPP_LINK_DISCOVERING;
+    return SPP_LINK_ACT_SEARCH;
+}
+
+spp_link_action_t spp_link_search_done(spp_link_t *link) {
+    if (link->state != SPP_LINK_DISCOVERING) {
+        return SPP_LINK_ACT_NONE;
+    }
+    link->state = SPP_LINK_MTU;
+    return SPP_LINK_ACT_REQUEST_MTU;
+}
+
+spp_link_action_t spp_link_mtu_done(spp_link_t *link) {
+    if (link->state != SPP_LINK_MTU) {
+        return SPP_LINK_ACT_NONE;
+    }
+    link->state = SPP_LINK_ATTRS;
+    return SPP_LINK_ACT_LOAD_ATTRS;
+}
+
+spp_link_action_t spp_link_attrs(spp_link_t *link, bool ok) {
+    if (link->state != SPP_LINK_ATTRS) {
+        return SPP_LINK_ACT_NONE;
+    }
+    if (ok) {
+        return subscribe(link);
+    }
+    if (link->direct) {
+        // Retained table does not fit this controller, discover it
+        link->direct = false;
+        link->state = SPP_LINK_DISCOVERING;
+        return SPP_LINK_ACT_SEARCH;
+    }
+    return SPP_LINK_ACT_CLOSE;
+}
+
+spp_link_action_t spp_link_notify_registered(spp_link_t *link, bool ok) {
+    if (link->state != SPP_LINK_REGISTERING) {
+        return SPP_LINK_ACT_NONE;
+    }
+    if (!ok) {
+        return SPP_LINK_ACT_CLOSE;
+    }
+    link->state = SPP_LINK_ENABLING;
+    return SPP_LINK_ACT_WRITE_CCCD;
+}
+
+spp_link_action_t spp_link_cccd_written(spp_link_t *link, bool ok) {
+    if (link->state != SPP_LINK_ENABLING) {
+        return SPP_LINK_ACT_NONE;
+    }
+    if (!ok) {
+        return SPP_LINK_ACT_CLOSE;
+    }
+    link->step++;
+    return subscribe(link);
+}
+
+spp_link_action_t spp_link_disconnected(spp_link_t *link) {
+    link->step = 0;
+    return start_scan(link);
+}
+
+bool spp_link_is_ready(const spp_link_t *link) {
+    return link->state == SPP_LINK_READY;
+}
@@ -0,0 +1,71 @@
+#ifndef SPP_LINK_H
+#define SPP_LINK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Connection sequence of the SPP client: scan (or a direct connection to the
+// controller from before deep sleep), service search, MTU exchange,
+// attribute table, then notifications on each subscribed characteristic.
+// It has no hardware or RTOS dependencies: the BLE client feeds it the
+// GAP/GATTC events and carries out the action each one returns.
+
+typedef enum {
+    SPP_LINK_IDLE,          // Until the scan parameters are set
+    SPP_LINK_SCANNING,
+    SPP_LINK_STOPPING_SCAN, // Controller found
+    SPP_LINK_OPENING,
+    SPP_LINK_ATTRS,         // Waiting for spp_link_attrs()
+    SPP_LINK_DISCOVERING,
+    SPP_LINK_MTU,
+    SPP_LINK_REGISTERING,   // Notification registration of characteristic `step`
+    SPP_LINK_ENABLING,      // Its client configuration descriptor write
+    SPP_LINK_READY,
+} spp_link_state_t;
+
+typedef enum {
+    SPP_LINK_ACT_NONE,
+    SPP_LINK_ACT_START_SCAN,
+    SPP_LINK_ACT_STOP_SCAN,
+    SPP_LINK_ACT_OPEN_PEER,        // Direct connection to the retained controller
+    SPP_LINK_ACT_OPEN_FOUND,       // Connection to the controller the scan found
+    SPP_LINK_ACT_FORGET_PEER,      // The retained controller did not answer, forget it and scan
+    SPP_LINK_ACT_RESTORE_ATTRS,    // Take the retained attribute table, then spp_link_attrs()
+    SPP_LINK_ACT_SEARCH,
+    SPP_LINK_ACT_REQUEST_MTU,
+    SPP_LINK_ACT_LOAD_ATTRS,       // Read the discovered attribute table, then spp_link_attrs()
+    SPP_LINK_ACT_REGISTER_NOTIFY,  // For characteristic `step`
+    SPP_LINK_ACT_WRITE_CCCD,       // Enable notifications of characteristic `step`
+    SPP_LINK_ACT_CLOSE,            // Give up on this connection, a disconnect follows
+} spp_link_action_t;
+
+typedef struct {
+    spp_link_state_t state;
+    size_t subscriptions;  // Characteristics to enable notifications on
+    size_t step;           // The one being subscribed
+    bool have_peer;        // A controller is retained from before deep sleep
+    bool direct;           // This connection is to it
+} spp_link_t;
+
+void spp_link_init(spp_link_t *link, size_t subscriptions, bool have_peer);
+
+spp_link_action_t spp_link_scan_params_set(spp_link_t *link);
+spp_link_action_t spp_link_found(spp_link_t *link);
+spp_link_action_t spp_link_scan_stopped(spp_link_t *link);
+spp_link_action_t spp_link_open_failed(spp_link_t *link);
+spp_link_action_t spp_link_connected(spp_link_t *link);
+spp_link_action_t spp_link_search_done(spp_link_t *link);
+
+// Also after a failed exchange, the link then keeps the default MTU
+spp_link_action_t spp_link_mtu_done(spp_link_t *link);
+
+spp_link_action_t spp_link_attrs(spp_link_t *link, bool ok);
+spp_link_action_t spp_link_notify_registered(spp_link_t *link, bool ok);
+spp_link_action_t spp_link_cccd_written(spp_link_t *link, bool ok);
+spp_link_action_t spp_link_disconnected(spp_link_t *link);
+
+// Every notification is enabled
+bool spp_link_is_ready(const spp_link_t *link);
+
+#endif // SPP_LINK_H
@@ -0,0 +1,214 @@
+#include "static_layer.h"
+#include <stdbool.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+
+#define TAG "STATIC_LAYER"
+#define BENCHMARK_ITERATIONS 10
+
+typedef struct {
+    lv_obj_t *source;      // Hidden widget the snapshot is taken from
+    lv_obj_t *image;       // Drawn in place of the source
+    lv_img_dsc_t dsc;
+    void *buf;
+    uint32_t buf_size;
+    bool refresh_pending;
+} static_item_t;
+
+static static_item_t items[STATIC_LAYER_MAX_ITEMS];
+
+static static_item_t *find_item(const lv_obj_t *source) {
+    for (size_t i = 0; i < STATIC_LAYER_MAX_ITEMS; i++) {
+        if (items[i].source == source && source != NULL) {
+            return &items[i];
+        }
+    }
+    return NULL;
+}
+
+static static_item_t *alloc_item(void) {
+    for (size_t i = 0; i < STATIC_LAYER_MAX_ITEMS; i++) {
+        if (items[i].image == NULL) {
+            return &items[i];
+        }
+    }
+    return NULL;
+}
+
+// An opaque snapshot paints its whole box black. That is only safe if no
+// visible widget drawn before the source shares any of that box.
+static bool covers_earlier_sibling(const static_item_t *item, const lv_area_t *area) {
+    lv_obj_t *parent = lv_obj_get_parent(item->source);
+    uint32_t index = lv_obj_get_index(item->source);
+
+    for (uint32_t i = 0; i < index; i++) {
+        lv_obj_t *sibling = lv_obj_get_child(parent, i);
+        lv_area_t common;
+        if (sibling == item->image || lv_obj_has_flag(sibling, LV_OBJ_FLAG_HIDDEN)) {
+            continue;
+        }
+        if (_lv_area_intersect(&common, area, &sibling->coords)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool take_snapshot(static_item_t *item) {
+    lv_area_t area;
+    lv_obj_update_layout(item->source);
+    lv_obj_get_coords(item->source, &area);
+    lv_area_increase(&area, _lv_obj_get_ext_draw_size(item->source), _lv_obj_get_ext_draw_size(item->source));
+
+    // Screens are black and snapshot buffers start out black, so RGB565 is
+    // enough unless the box would hide part of another widget
+    lv_img_cf_t cf = covers_earlier_sibling(item, &area) ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+    uint32_t size = lv_snapshot_buf_size_needed(item->source, cf);
+    if (size == 0) {
+        return false;
+    }
+
+    if (size > item->buf_size) {
+        heap_caps_free(item->buf);
+        item->buf = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+        item->buf_size = item->buf != NULL ? size : 0;
+        if (item->buf == NULL) {
+            ESP_LOGW(TAG, "No memory for a %lu byte snapshot", (unsigned long)size);
+            return false;
+        }
+    }
+
+    if (lv_snapshot_take_to_buf(item->source, cf, &item->dsc, item->buf, item->buf_size) != LV_RES_OK) {
+        return false;
+    }
+    lv_img_cache_invalidate_src(&item->dsc);
+    lv_img_set_src(item->image, &item->dsc);
+    lv_obj_align_to(item->image, item->source, LV_ALIGN_CENTER, 0, 0);
+    return true;
+}
+
+static void refresh_async(void *user_data) {
+    static_item_t *item = user_data;
+
+    item->refresh_pending = false;
+    if (item->source != NULL && !take_snapshot(item)) {
+        // Better slow than stale: draw the widget itself again
+        lv_obj_clear_flag(item->source, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_flag(item->image, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+static void source_event_cb(lv_event_t *e) {
+    static_item_t *item = lv_event_get_user_data(e);
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_SIZE_CHANGED:
+        case LV_EVENT_STYLE_CHANGED:
+            // Layout changes come in bursts, capture once they are done
+            if (!item->refresh_pending) {
+                item->refresh_pending = true;
+                lv_async_call(refresh_async, item);
+            }
+            break;
+        case LV_EVENT_DELETE:
+            item->source = NULL;
+            break;
+        default:
+            break;
+    }
+}
+
+static void image_delete_cb(lv_event_t *e) {
+    static_item_t *item = lv_event_get_user_data(e);
+
+    if (item->refresh_pending) {
+        lv_async_call_cancel(refresh_async, item);
+    }
+    if (item->source != NULL) {
+        lv_obj_remove_event_cb_with_user_data(item->source, source_event_cb, item);
+    }
+    heap_caps_free(item->buf);
+    memset(item, 0, sizeof(*item));
+}
+
+void static_layer_capture(lv_obj_t **const *widgets, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        lv_obj_t *source = *widgets[i];
+        if (source == NULL || find_item(source) != NULL) {
+            continue;
+        }
+
+        static_item_t *item = alloc_item();
+        if (item == NULL) {
+            ESP_LOGW(TAG, "Out of static layer slots");
+            return;
+        }
+
+        item->source = source;
+        item->image = lv_img_create(lv_obj_get_parent(source));
+        lv_obj_clear_flag(item->image, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_move_to_index(item->image, lv_obj_get_index(source));
+
+        if (!take_snapshot(item)) {
+            // Leaves the widget as it was
+            lv_obj_del(item->image);
+            heap_caps_free(item->buf);
+            memset(item, 0, sizeof(*item));
+            continue;
+        }
+
+        lv_obj_add_flag(source, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_event_cb(source, source_event_cb, LV_EVENT_ALL, item);
+        lv_obj_add_event_cb(item->image, image_delete_cb, LV_EVENT_DELETE, item);
+    }
+}
+
+void static_layer_refresh(lv_obj_t *widget) {
+    static_item_t *item = find_item(widget);
+
+    if (item != NULL) {
+        refresh_async(item);
+    }
+}
+
+static void set_cached(lv_obj_t *screen, bool cached) {
+    for (size_t i = 0; i < STATIC_LAYER_MAX_ITEMS; i++) {
+        if (items[i].source == NULL || lv_obj_get_screen(items[i].source) != screen) {
+            continue;
+        }
+        if (cached) {
+            lv_obj_add_flag(items[i].source, LV_OBJ_FLAG_HIDDEN);
+            lv_obj_clear_flag(items[i].image, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_clear_flag(items[i].source, LV_OBJ_FLAG_HIDDEN);
+            lv_obj_add_flag(items[i].image, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+}
+
+// Includes the wait for the panel transfer, which is the same in both cases
+static uint32_t time_full_refresh(lv_obj_t *screen) {
+    uint32_t start = esp_cpu_get_cycle_count();
+
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        lv_obj_invalidate(screen);
+        lv_refr_now(NULL);
+    }
+    return (esp_cpu_get_cycle_count() - start) / BENCHMARK_ITERATIONS;
+}
+
+void static_layer_benchmark(lv_obj_t *screen) {
+    if (screen == NULL || screen != lv_scr_act()) {
+        return;
+    }
+
+    uint32_t cached = time_full_refresh(screen);
+    set_cached(screen, false);
+    uint32_t live = time_full_refresh(screen);
+    set_cached(screen, true);
+
+    ESP_LOGI(TAG, "Full refresh: %lu cycles with the static layer, %lu without", (unsigned long)cached,
+             (unsigned long)live);
+}
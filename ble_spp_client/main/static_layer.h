@@ -0,0 +1,25 @@
+#ifndef STATIC_LAYER_H
+#define STATIC_LAYER_H
+
+#include <stddef.h>
+#include "lvgl.h"
+
+// Maximum number of widgets cached across all live screens
+#define STATIC_LAYER_MAX_ITEMS 12
+
+// Set to 1 to time a full screen refresh with and without the cached layer
+// every time a screen with static widgets is built
+#define STATIC_LAYER_BENCHMARK 0
+
+// Render each widget once into an RGB565 snapshot and draw that image in its
+// place. The widget is kept hidden and re-captured when its size or style
+// changes. Snapshots are freed together with their screen.
+void static_layer_capture(lv_obj_t **const *widgets, size_t count);
+
+// Re-capture a cached widget, e.g. after lv_label_set_text() on it
+void static_layer_refresh(lv_obj_t *widget);
+
+// Log the cost of a full refresh of the screen with and without its snapshots
+void static_layer_benchmark(lv_obj_t *screen);
+
+#endif // STATIC_LAYER_H
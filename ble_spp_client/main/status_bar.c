@@ -0,0 +1,188 @@
+#include "status_bar.h"
+#include "ui/ui.h"
+#include "adc.h"
+#include "ble_spp_client.h"
+#include "ui_format.h"
+
+#define SIGNAL_BAR_WIDTH 3
+#define SIGNAL_BAR_GAP 2
+#define SIGNAL_BAR_STEP 4   // Height added per bar
+#define SIGNAL_COLOR_ON 0xFFFFFF
+#define SIGNAL_COLOR_OFF 0x404040
+
+static lv_obj_t *bar;
+static lv_obj_t *signal_meter;
+static lv_obj_t *signal_bars[STATUS_BAR_SIGNAL_BARS];
+
+// Last state shown, -1 forces the next refresh to draw it
+static int shown_signal = -1;    // Lit bars, 0 while disconnected
+static int32_t shown_battery = -1;
+static char battery_text[8];     // Referenced by the battery label
+
+static lv_obj_t *create_plain(lv_obj_t *parent) {
+    // No theme styles: the bar must be opaque and cheap to draw
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    return obj;
+}
+
+static void create_signal(void) {
+    lv_coord_t width = STATUS_BAR_SIGNAL_BARS * (SIGNAL_BAR_WIDTH + SIGNAL_BAR_GAP) - SIGNAL_BAR_GAP;
+
+    signal_meter = create_plain(bar);
+    lv_obj_set_size(signal_meter, width, STATUS_BAR_SIGNAL_BARS * SIGNAL_BAR_STEP);
+    lv_obj_add_flag(signal_meter, LV_OBJ_FLAG_HIDDEN);
+
+    for (int i = 0; i < STATUS_BAR_SIGNAL_BARS; i++) {
+        signal_bars[i] = create_plain(signal_meter);
+        lv_obj_set_size(signal_bars[i], SIGNAL_BAR_WIDTH, (i + 1) * SIGNAL_BAR_STEP);
+        lv_obj_align(signal_bars[i], LV_ALIGN_BOTTOM_LEFT, i * (SIGNAL_BAR_WIDTH + SIGNAL_BAR_GAP), 0);
+        lv_obj_set_style_bg_opa(signal_bars[i], LV_OPA_COVER, LV_PART_MAIN);
+        lv_obj_set_style_bg_color(signal_bars[i], lv_color_hex(SIGNAL_COLOR_OFF), LV_PART_MAIN);
+    }
+}
+
+static void refresh_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    status_bar_refresh();
+}
+
+void status_bar_init(void) {
+    if (bar != NULL) {
+        return;
+    }
+
+    bar = create_plain(lv_layer_top());
+    lv_obj_set_size(bar, LV_PCT(100), STATUS_BAR_HEIGHT);
+    lv_obj_set_style_bg_color(bar, lv_color_black(), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(bar, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_add_flag(bar, LV_OBJ_FLAG_HIDDEN);
+    create_signal();
+
+    // Drawn where no screen covers the display, i.e. under a hidden bar
+    lv_disp_set_bg_color(NULL, lv_color_black());
+
+    lv_timer_create(refresh_timer_cb, STATUS_BAR_PERIOD_MS, NULL);
+}
+
+void status_bar_adopt(lv_obj_t **const *widgets, size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        lv_obj_t *obj = *widgets[i];
+        if (obj == NULL) {
+            continue;
+        }
+
+        // The bar starts at the top left of the display, so display
+        // coordinates are also coordinates inside the bar
+        lv_obj_update_layout(obj);
+        lv_area_t coords;
+        lv_obj_get_coords(obj, &coords);
+        lv_obj_set_parent(obj, bar);
+        lv_obj_set_align(obj, LV_ALIGN_TOP_LEFT);
+        lv_obj_set_pos(obj, coords.x1, coords.y1);
+    }
+
+    // The quality indicator replaces the no connection icon while connected
+    if (ui_no_connection_icon != NULL && lv_obj_get_parent(ui_no_connection_icon) == bar) {
+        lv_obj_align_to(signal_meter, ui_no_connection_icon, LV_ALIGN_CENTER, 0, 0);
+    }
+    if (ui_controller_battery_text != NULL && lv_obj_get_parent(ui_controller_battery_text) == bar) {
+        // Shown once the first battery reading is in
+        lv_label_set_text_static(ui_controller_battery_text, "");
+    }
+
+    shown_signal = -1;
+    shown_battery = -1;
+    status_bar_refresh();
+}
+
+static void screen_event_cb(lv_event_t *e) {
+    // lv_scr_load_anim() puts both screens back to 0,0. Both events come
+    // before the layout is updated, so the screens never actually move and
+    // the load only invalidates the content region.
+    lv_obj_set_y(lv_event_get_target(e), STATUS_BAR_HEIGHT);
+}
+
+void status_bar_fit_screen(lv_obj_t *screen) {
+    // LVGL keeps screens at display size, so the screen is moved down and
+    // hangs off the bottom where it is clipped. The padding moves its content
+    // area back onto the display, SquareLine's centre aligned positions stay.
+    lv_obj_set_style_pad_top(screen, -STATUS_BAR_HEIGHT, LV_PART_MAIN);
+    lv_obj_set_style_pad_bottom(screen, STATUS_BAR_HEIGHT, LV_PART_MAIN);
+    lv_obj_set_y(screen, STATUS_BAR_HEIGHT);
+    lv_obj_add_event_cb(screen, screen_event_cb, LV_EVENT_SCREEN_LOADED, NULL);
+    lv_obj_add_event_cb(screen, screen_event_cb, LV_EVENT_SCREEN_UNLOADED, NULL);
+}
+
+void status_bar_set_visible(bool visible) {
+    // Toggling the flag invalidates the bar even if nothing changes
+    if (bar == NULL || visible != lv_obj_has_flag(bar, LV_OBJ_FLAG_HIDDEN)) {
+        return;
+    }
+    if (visible) {
+        lv_obj_clear_flag(bar, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(bar, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+static void show_signal(int lit) {
+    if (lit == shown_signal) {
+        return;
+    }
+
+    if (ui_no_connection_icon != NULL) {
+        if (lit == 0) {
+            lv_obj_clear_flag(ui_no_connection_icon, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(ui_no_connection_icon, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    if (lit == 0) {
+        lv_obj_add_flag(signal_meter, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_clear_flag(signal_meter, LV_OBJ_FLAG_HIDDEN);
+    }
+
+    for (int i = 0; i < STATUS_BAR_SIGNAL_BARS; i++) {
+        lv_obj_set_style_bg_color(signal_bars[i], lv_color_hex(i < lit ? SIGNAL_COLOR_ON : SIGNAL_COLOR_OFF),
+                                  LV_PART_MAIN);
+    }
+    shown_signal = lit;
+}
+
+static void show_battery(int32_t percent) {
+    if (percent == shown_battery || ui_controller_battery_text == NULL) {
+        return;
+    }
+
+    if (percent < 0) {
+        lv_label_set_text_static(ui_controller_battery_text, "");
+    } else {
+        ui_format_fixed(battery_text, sizeof(battery_text), percent, 0, NULL);
+        lv_label_set_text_static(ui_controller_battery_text, battery_text);
+    }
+    shown_battery = percent;
+}
+
+void status_bar_refresh(void) {
+    if (bar == NULL) {
+        return;
+    }
+
+    // Connected always lights at least one bar, so 0 means disconnected
+    int lit = 0;
+    if (is_connect) {
+        lit = (get_connection_quality() * STATUS_BAR_SIGNAL_BARS + 99) / 100;
+        if (lit < 1) {
+            lit = 1;
+        }
+    }
+    show_signal(lit);
+    show_battery(adc_get_battery_percent());
+}
@@ -0,0 +1,34 @@
+#ifndef STATUS_BAR_H
+#define STATUS_BAR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "lvgl.h"
+
+// Rows at the top of the display owned by the status bar. Screens shown with
+// the bar only cover the rows below it, so loading one never redraws the bar.
+#define STATUS_BAR_HEIGHT 64
+
+// How often connection quality and battery level are polled
+#define STATUS_BAR_PERIOD_MS 1000
+
+// Number of bars in the connection quality indicator
+#define STATUS_BAR_SIGNAL_BARS 4
+
+// Create the bar on lv_layer_top(), hidden until status_bar_set_visible()
+void status_bar_init(void);
+
+// Move SquareLine widgets into the bar, keeping their place on the display.
+// They are no longer part of their screen afterwards.
+void status_bar_adopt(lv_obj_t **const *widgets, size_t count);
+
+// Shrink a screen to the content region below the bar. Children keep the
+// positions they were designed with, anything under the bar is clipped.
+void status_bar_fit_screen(lv_obj_t *screen);
+
+void status_bar_set_visible(bool visible);
+
+// Update the bar from the connection and battery state, touches only what changed
+void status_bar_refresh(void);
+
+#endif // STATUS_BAR_H
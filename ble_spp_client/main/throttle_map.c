@@ -0,0 +1,21 @@
+#include "throttle_map.h"
+
+uint8_t throttle_map(uint32_t raw, uint32_t min, uint32_t max) {
+    if (max <= min) {
+        return 0;
+    }
+    if (raw < min) {
+        raw = min;
+    }
+    if (raw > max) {
+        raw = max;
+    }
+
+    uint32_t mapped = (raw - min) * (THROTTLE_MAP_MAX - THROTTLE_MAP_OFFSET) / (max - min);
+
+    // Add offset only to non-zero values to maintain 0 at minimum
+    if (mapped > 0) {
+        mapped += THROTTLE_MAP_OFFSET;
+    }
+    return mapped > THROTTLE_MAP_MAX ? THROTTLE_MAP_MAX : (uint8_t)mapped;
+}
@@ -0,0 +1,17 @@
+#ifndef THROTTLE_MAP_H
+#define THROTTLE_MAP_H
+
+#include <stdint.h>
+
+// Maps a raw throttle reading onto the 0-255 sent to the controller. It has
+// no hardware or RTOS dependencies, the ADC driver hands it the reading and
+// the calibrated range.
+
+// Any throttle off the minimum starts here, below it the motor only cogs
+#define THROTTLE_MAP_OFFSET 18
+#define THROTTLE_MAP_MAX 255
+
+// Clamped to [min, max] first, 0 when the range is empty
+uint8_t throttle_map(uint32_t raw, uint32_t min, uint32_t max);
+
+#endif // THROTTLE_MAP_H
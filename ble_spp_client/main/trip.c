@@ -0,0 +1,203 @@
+#include "trip.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs.h"
+#include "ble_spp_client.h"
+#include "vesc_config.h"
+#include "executor.h"
+#include "resume.h"
+#include "trip_integrator.h"
+
+#define TAG "TRIP"
+
+static SemaphoreHandle_t mutex = NULL;  // The totals and the NVS journal
+static trip_totals_t totals;
+static uint32_t saved_odometer_m;
+static uint32_t odometer_rem_mm;  // Below the metre the odometer counts in
+
+// Remainders of the integration, carried into the next tick
+static trip_integrator_t integrator;
+
+static int32_t rest_voltage_dv;   // Last reading at low current, 0 until one
+static uint32_t last_ms;
+static bool connected = false;
+
+static const char *journal_key(uint32_t seq, char *key, size_t len) {
+    snprintf(key, len, "odo%lu", (unsigned long)(seq % TRIP_JOURNAL_SLOTS));
+    return key;
+}
+
+// Newest slot wins, slots are (seq << 32) | metres
+static void load_odometer(void) {
+    nvs_handle_t nvs;
+    char key[8];
+    bool found = false;
+
+    if (nvs_open(TRIP_NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        ESP_LOGI(TAG, "No odometer yet");
+        return;
+    }
+    for (uint32_t i = 0; i < TRIP_JOURNAL_SLOTS; i++) {
+        uint64_t entry;
+        if (nvs_get_u64(nvs, journal_key(i, key, sizeof(key)), &entry) != ESP_OK) {
+            continue;
+        }
+        uint32_t seq = (uint32_t)(entry >> 32);
+        if (!found || (int32_t)(seq - totals.journal_seq) >= 0) {
+            totals.journal_seq = seq + 1;
+            totals.odometer_m = (uint32_t)entry;
+            found = true;
+        }
+    }
+    nvs_close(nvs);
+}
+
+// Mutex held
+static void save_odometer(void) {
+    nvs_handle_t nvs;
+    char key[8];
+
+    if (totals.odometer_m == saved_odometer_m) {
+        return;
+    }
+    esp_err_t ret = nvs_open(TRIP_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret == ESP_OK) {
+        uint64_t entry = ((uint64_t)totals.journal_seq << 32) | totals.odometer_m;
+        ret = nvs_set_u64(nvs, journal_key(totals.journal_seq, key, sizeof(key)), entry);
+        if (ret == ESP_OK) {
+            ret = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Odometer not saved: %s", esp_err_to_name(ret));
+        return;
+    }
+    totals.journal_seq++;
+    saved_odometer_m = totals.odometer_m;
+}
+
+// Mutex held
+static void integrate(uint32_t dt_ms) {
+    int32_t erpm = get_latest_erpm();
+    int32_t voltage_dv = get_latest_voltage_dv();
+    int32_t current_in_da = get_latest_current_in_da();
+
+    // The factor follows config changes
+    uint32_t mm = trip_integrator_distance_mm(&integrator, erpm, vesc_config_nm_per_erev(), dt_ms);
+    totals.distance_mm += mm;
+
+    odometer_rem_mm += mm;
+    totals.odometer_m += odometer_rem_mm / 1000;
+    odometer_rem_mm %= 1000;
+
+    totals.energy_mwh += trip_integrator_energy_mwh(&integrator, voltage_dv, current_in_da, dt_ms);
+
+    if (rest_voltage_dv == 0 || abs(current_in_da) < TRIP_REST_CURRENT_DA) {
+        rest_voltage_dv = voltage_dv;
+    }
+}
+
+static void tick(void *arg) {
+    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (!is_connect) {
+        if (connected) {
+            connected = false;
+            save_odometer();
+        }
+    } else if (!connected) {
+        // Time starts at the first tick of the link, not at the last one
+        connected = true;
+        last_ms = now_ms;
+    } else {
+        uint32_t dt_ms = now_ms - last_ms;
+        last_ms = now_ms;
+        integrate(dt_ms < TRIP_MAX_GAP_MS ? dt_ms : TRIP_MAX_GAP_MS);
+        if (totals.odometer_m - saved_odometer_m >= TRIP_ODOMETER_SAVE_M) {
+            save_odometer();
+        }
+    }
+    xSemaphoreGive(mutex);
+}
+
+esp_err_t trip_init(void) {
+    if (mutex != NULL) {
+        return ESP_OK;
+    }
+    mutex = xSemaphoreCreateMutex();
+    if (mutex == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Carried over deep sleep, the odometer in it is at least as new as NVS
+    if (!resume_get_trip(&totals)) {
+        load_odometer();
+    }
+    saved_odometer_m = totals.odometer_m;
+    trip_integrator_init(&integrator);
+    ESP_LOGI(TAG, "Odometer %lu m, trip %lu m", (unsigned long)totals.odometer_m,
+             (unsigned long)(totals.distance_mm / 1000));
+
+    return executor_every(EXECUTOR_BACKGROUND, TRIP_PERIOD_MS, tick, NULL);
+}
+
+void trip_flush(void) {
+    if (mutex == NULL) {
+        return;
+    }
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    save_odometer();
+    resume_set_trip(&totals);
+    xSemaphoreGive(mutex);
+}
+
+int32_t trip_get_distance_hm(void) {
+    return (int32_t)(totals.distance_mm / 100000);
+}
+
+int32_t trip_get_energy_dwh(void) {
+    return totals.energy_mwh / 100;
+}
+
+int32_t trip_get_efficiency_dwh_km(void) {
+    uint32_t distance_mm = totals.distance_mm;
+
+    if (distance_mm < TRIP_MIN_DISTANCE_M * 1000) {
+        return -1;
+    }
+    // mWh per m is Wh per km
+    return (int32_t)((int64_t)totals.energy_mwh * 10000 / distance_mm);
+}
+
+int32_t trip_get_range_hm(void) {
+    uint32_t distance_mm = totals.distance_mm;
+    int32_t energy_mwh = totals.energy_mwh;
+
+    if (distance_mm < TRIP_MIN_DISTANCE_M * 1000 || energy_mwh <= 0 || rest_voltage_dv == 0) {
+        return -1;
+    }
+
+    int32_t cell_mv = rest_voltage_dv * 100 / TRIP_BATTERY_CELLS;
+    if (cell_mv <= TRIP_CELL_EMPTY_MV) {
+        return 0;
+    }
+    if (cell_mv > TRIP_CELL_FULL_MV) {
+        cell_mv = TRIP_CELL_FULL_MV;
+    }
+    int64_t remaining_mwh = (int64_t)TRIP_BATTERY_WH * 1000 * (cell_mv - TRIP_CELL_EMPTY_MV) /
+                            (TRIP_CELL_FULL_MV - TRIP_CELL_EMPTY_MV);
+
+    // At the trip's consumption so far
+    return (int32_t)(remaining_mwh * distance_mm / energy_mwh / 100000);
+}
+
+int32_t trip_get_odometer_km(void) {
+    return (int32_t)(totals.odometer_m / 1000);
+}
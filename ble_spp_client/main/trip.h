@@ -0,0 +1,58 @@
+#ifndef TRIP_H
+#define TRIP_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+// Trip computer. While connected, distance is integrated from the eRPM and
+// energy from battery voltage x input current every TRIP_PERIOD_MS, in
+// integers with the remainder carried over, so nothing is lost to rounding
+// however long the ride. The trip starts at zero on a cold boot and carries
+// on over deep sleep. The lifetime odometer is kept in NVS.
+#define TRIP_PERIOD_MS 100
+
+// A longer gap between two ticks (a stalled worker) counts as this long
+#define TRIP_MAX_GAP_MS 500
+
+// The odometer is written to NVS after this many metres, on disconnect and
+// before deep sleep. Each write goes to the next of TRIP_JOURNAL_SLOTS keys
+// with a sequence number, the newest one is read back at boot, so a write
+// cut short leaves the previous value.
+#define TRIP_NVS_NAMESPACE "trip"
+#define TRIP_JOURNAL_SLOTS 4
+#define TRIP_ODOMETER_SAVE_M 500
+
+// Battery for the range estimate, state of charge is linear between the
+// empty and full cell voltage, read when the battery current is low
+#define TRIP_BATTERY_CELLS 10
+#define TRIP_BATTERY_WH 360
+#define TRIP_CELL_EMPTY_MV 3300
+#define TRIP_CELL_FULL_MV 4200
+#define TRIP_REST_CURRENT_DA 20
+
+// Wh/km and range need this much distance to mean anything
+#define TRIP_MIN_DISTANCE_M 200
+
+// Counters kept over deep sleep, see resume.h
+typedef struct {
+    uint32_t distance_mm;
+    int32_t energy_mwh;     // Regenerated energy counts back
+    uint32_t odometer_m;
+    uint32_t journal_seq;   // Sequence number of the next odometer write
+} trip_totals_t;
+
+// Load the odometer and start integrating, after vesc_config_init()
+esp_err_t trip_init(void);
+
+// Write the odometer and keep the trip for the next wake, before deep sleep.
+// Any task.
+void trip_flush(void);
+
+// Readers for the UI, any task. Wh/km and range are -1 until known.
+int32_t trip_get_distance_hm(void);        // 100 m
+int32_t trip_get_energy_dwh(void);         // 0.1 Wh
+int32_t trip_get_efficiency_dwh_km(void);  // 0.1 Wh/km
+int32_t trip_get_range_hm(void);           // 100 m
+int32_t trip_get_odometer_km(void);
+
+#endif // TRIP_H
@@ -0,0 +1,22 @@
+#include "trip_integrator.h"
+
+void trip_integrator_init(trip_integrator_t *st) {
+    *st = (trip_integrator_t){0};
+}
+
+uint32_t trip_integrator_distance_mm(trip_integrator_t *st, int32_t erpm, uint32_t nm_per_erev, uint32_t dt_ms) {
+    uint64_t magnitude = erpm < 0 ? (uint64_t)(-(int64_t)erpm) : (uint64_t)erpm;
+
+    st->distance_acc += magnitude * dt_ms * nm_per_erev;
+    uint32_t mm = (uint32_t)(st->distance_acc / TRIP_INTEGRATOR_DISTANCE_DIVISOR);
+    st->distance_acc %= TRIP_INTEGRATOR_DISTANCE_DIVISOR;
+    return mm;
+}
+
+int32_t trip_integrator_energy_mwh(trip_integrator_t *st, int32_t voltage_dv, int32_t current_in_da, uint32_t dt_ms) {
+    // Truncating division keeps the sign of the remainder
+    st->energy_acc += (int64_t)voltage_dv * current_in_da * dt_ms;
+    int32_t mwh = (int32_t)(st->energy_acc / TRIP_INTEGRATOR_ENERGY_DIVISOR);
+    st->energy_acc %= TRIP_INTEGRATOR_ENERGY_DIVISOR;
+    return mwh;
+}
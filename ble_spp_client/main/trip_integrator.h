@@ -0,0 +1,33 @@
+#ifndef TRIP_INTEGRATOR_H
+#define TRIP_INTEGRATOR_H
+
+#include <stdint.h>
+
+// Distance and energy integration of the trip computer. It has no hardware
+// or RTOS dependencies, trip.c hands it the latest telemetry and the time
+// since the last step. Each step returns whole mm and mWh, the remainders
+// are carried into the next one so nothing is lost to rounding however
+// long the ride.
+
+// erpm x ms x (nm per electrical turn) over this is mm
+#define TRIP_INTEGRATOR_DISTANCE_DIVISOR (60000ULL * 1000000)
+
+// dV x dA x ms over this is mWh
+#define TRIP_INTEGRATOR_ENERGY_DIVISOR 360000
+
+typedef struct {
+    uint64_t distance_acc;  // Below a mm, in units of the distance divisor
+    int64_t energy_acc;     // Below a mWh either way, regen carries too
+} trip_integrator_t;
+
+void trip_integrator_init(trip_integrator_t *st);
+
+// Both directions add to the distance. The factor may change between steps.
+// The product fits 64 bits up to 8 million eRPM over a 500 ms step, at the
+// largest factor vesc_speed_factors() gives.
+uint32_t trip_integrator_distance_mm(trip_integrator_t *st, int32_t erpm, uint32_t nm_per_erev, uint32_t dt_ms);
+
+// Negative while regenerating
+int32_t trip_integrator_energy_mwh(trip_integrator_t *st, int32_t voltage_dv, int32_t current_in_da, uint32_t dt_ms);
+
+#endif // TRIP_INTEGRATOR_H
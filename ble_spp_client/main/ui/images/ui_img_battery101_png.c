@@ -10,51 +10,158 @@
 #endif
 
 // IMAGE DATA: assets/battery101.png
+// Packed by tools/img_pack.py: RGB565, pre-blended on 0x000000
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_battery101_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x4B,0x36,0x10,0xE4,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xE3,0x36,0x10,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x10,0xE3,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xE2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xAF,0x06,0x36,0x10,0x89,0x36,0x30,0xE6,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xE5,0x36,0x30,0x88,0x2E,0xAF,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x88,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xE6,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xFF,0x35,0xEF,0xFF,0x35,0xCF,0xFF,0x35,0xEF,0xFF,0x36,0x0F,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x35,0xEF,0xFF,0x2D,0xAE,0xFF,0x35,0x8E,0xFF,0x2D,0x8E,0xFF,0x35,0xEF,0xFF,0x36,0x10,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x0F,0xFF,0x35,0xCF,0xFF,0x3D,0x8D,0xFF,0xEE,0xE4,0xFF,0x4D,0xAC,0xFF,0x35,0xCF,0xFF,0x36,0x10,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xFF,0x35,0xEF,0xFF,0x2D,0x8E,0xFF,0xB6,0x67,0xFF,0xFF,0x03,0xFF,0x35,0x8E,0xFF,0x35,0xCF,0xFF,0x36,0x10,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x35,0xEF,0xFF,0x2D,0xAE,0xFF,0x6D,0xEB,0xFF,0xFF,0x03,0xFF,0xD6,0xA5,0xFF,0x2D,0x8E,0xFF,0x35,0xEF,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x0F,0xFF,0x35,0xCF,0xFF,0x3D,0x8D,0xFF,0xEE,0xE4,0xFF,0xFF,0x03,0xFF,0xAE,0x67,0xFF,0x2D,0xAE,0xFF,0x35,0xEF,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xFF,0x35,0xEF,0xFF,0x2D,0x8E,0xFF,0xB6,0x67,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0x86,0x09,0xFF,0x35,0xAF,0xFF,0x36,0x0F,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x35,0xEF,0xFF,0x2D,0xAE,0xFF,0x6D,0xEB,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0x55,0xCC,0xFF,0x35,0xCF,0xFF,0x36,0x0F,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x0F,0xFF,0x35,0xCF,0xFF,0x3D,0x8D,0xFF,0xEE,0xE4,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0x35,0x8E,0xFF,0x35,0xCF,0xFF,0x36,0x10,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xFF,0x35,0xEF,0xFF,0x2D,0x8E,0xFF,0xBE,0x87,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xD6,0xA5,0xFF,0x2D,0x8E,0xFF,0x35,0xCF,0xFF,0x35,0xCF,0xFF,0x35,0xCF,0xFF,0x35,0xEF,0xFF,0x35,0xEF,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x35,0xEF,0xFF,0x2D,0xAE,0xFF,0x6D,0xEA,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xAE,0x67,0xFF,0x2D,0x6E,0xFF,0x2D,0x6E,0xFF,0x2D,0x6E,0xFF,0x2D,0x6E,0xFF,0x2D,0x8E,0xFF,0x35,0xCF,0xFF,0x36,0x0F,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x0F,0xFF,0x35,0xCF,0xFF,0x3D,0xAD,0xFF,0xEE,0xE4,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0x8E,0x29,0xFF,0x2D,0xAE,0xFF,0x35,0xEF,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x35,0xEF,0xFF,0x2D,0xAE,0xFF,0x8E,0x29,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xEE,0xE4,0xFF,0x3D,0xAD,0xFF,0x35,0xCF,0xFF,0x36,0x0F,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x0F,0xFF,0x35,0xCF,0xFF,0x2D,0x8E,0xFF,0x2D,0x6E,0xFF,0x2D,0x6E,0xFF,0x2D,0x6E,0xFF,0x2D,0x6E,0xFF,0xAE,0x67,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0x75,0xEA,0xFF,0x2D,0xAE,0xFF,0x35,0xEF,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x35,0xEF,0xFF,0x35,0xEF,0xFF,0x35,0xCF,0xFF,0x35,0xCF,0xFF,0x35,0xCF,0xFF,0x2D,0x8E,0xFF,0xD6,0xA5,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xB6,0x67,0xFF,0x2D,0x8E,0xFF,0x35,0xCF,0xFF,0x36,0x10,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xFF,0x35,0xCF,0xFF,0x35,0x8E,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xEE,0xE4,0xFF,0x45,0x8D,0xFF,0x35,0xCF,0xFF,0x36,0x0F,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x0F,0xFF,0x35,0xCF,0xFF,0x5D,0xCC,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0x75,0xEA,0xFF,0x2D,0xAE,0xFF,0x35,0xEF,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x0F,0xFF,0x35,0xAF,0xFF,0x86,0x09,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0xFF,0xB6,0x67,0xFF,0x2D,0x8E,0xFF,0x35,0xCF,0xFF,0x36,0x10,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x35,0xEF,0xFF,0x2D,0x8E,0xFF,0xAE,0x67,0xFF,0xFF,0x03,0xFF,0xEE,0xE4,0xFF,0x3D,0xAD,0xFF,0x35,0xCF,0xFF,0x36,0x0F,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x35,0xEF,0xFF,0x2D,0x8E,0xFF,0xD6,0xA5,0xFF,0xFF,0x03,0xFF,0x75,0xEA,0xFF,0x2D,0xAE,0xFF,0x35,0xEF,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xFF,0x35,0xCF,0xFF,0x35,0x8E,0xFF,0xFF,0x03,0xFF,0xB6,0x67,0xFF,0x2D,0x8E,0xFF,0x35,0xEF,0xFF,0x36,0x10,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xFF,0x35,0xCF,0xFF,0x4D,0xAC,0xFF,0xEE,0xE4,0xFF,0x3D,0x8D,0xFF,0x35,0xCF,0xFF,0x36,0x0F,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xFF,0x35,0xCF,0xFF,0x2D,0x8E,0xFF,0x35,0x8E,0xFF,0x2D,0xAE,0xFF,0x35,0xEF,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x0F,0xFF,0x35,0xEF,0xFF,0x35,0xCF,0xFF,0x35,0xEF,0xFF,0x36,0x10,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x10,0xE5,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x87,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xAF,0x06,0x36,0x30,0x87,0x36,0x10,0xE5,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xE4,0x36,0x30,0x86,0x2E,0xAF,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x11,0xC5,0x2D,0x6E,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x2D,0x6E,0x11,0xC5,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x6E,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x2D,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x1B,0x49,0x2D,0x8E,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x2D,0x6E,0x1B,0x49,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x49,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x1B,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x8E,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x2D,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x10,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x10,0x35,0xEF,0x35,0xCF,0x35,0xEF,0x36,0x0F,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x35,0xEF,0x2D,0xAE,0x35,0x8E,0x2D,0x8E,0x35,0xEF,0x36,0x10,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x0F,0x35,0xCF,0x3D,0x8D,0xEE,0xE4,0x4D,0xAC,0x35,0xCF,0x36,0x10,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x10,0x35,0xEF,0x2D,0x8E,0xB6,0x67,0xFF,0x03,0x35,0x8E,0x35,0xCF,0x36,0x10,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x35,0xEF,0x2D,0xAE,0x6D,0xEB,0xFF,0x03,0xD6,0xA5,0x2D,0x8E,0x35,0xEF,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x0F,0x35,0xCF,0x3D,0x8D,0xEE,0xE4,0xFF,0x03,0xAE,0x67,0x2D,0xAE,0x35,0xEF,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x10,0x35,0xEF,0x2D,0x8E,0xB6,0x67,0xFF,0x03,0xFF,0x03,0x86,0x09,0x35,0xAF,0x36,0x0F,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x35,0xEF,0x2D,0xAE,0x6D,0xEB,0xFF,0x03,0xFF,0x03,0xFF,0x03,0x55,0xCC,0x35,0xCF,0x36,0x0F,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x0F,0x35,0xCF,0x3D,0x8D,0xEE,0xE4,0xFF,0x03,0xFF,0x03,0xFF,0x03,0x35,0x8E,0x35,0xCF,0x36,0x10,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x10,0x35,0xEF,0x2D,0x8E,0xBE,0x87,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xD6,0xA5,0x2D,0x8E,0x35,0xCF,0x35,0xCF,0x35,0xCF,0x35,0xEF,0x35,0xEF,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x35,0xEF,0x2D,0xAE,0x6D,0xEA,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xAE,0x67,0x2D,0x6E,0x2D,0x6E,0x2D,0x6E,0x2D,0x6E,0x2D,0x8E,0x35,0xCF,0x36,0x0F,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x0F,0x35,0xCF,0x3D,0xAD,0xEE,0xE4,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0x8E,0x29,0x2D,0xAE,0x35,0xEF,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x35,0xEF,0x2D,0xAE,0x8E,0x29,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xEE,0xE4,0x3D,0xAD,0x35,0xCF,0x36,0x0F,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x0F,0x35,0xCF,0x2D,0x8E,0x2D,0x6E,0x2D,0x6E,0x2D,0x6E,0x2D,0x6E,0xAE,0x67,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0x75,0xEA,0x2D,0xAE,0x35,0xEF,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x35,0xEF,0x35,0xEF,0x35,0xCF,0x35,0xCF,0x35,0xCF,0x2D,0x8E,0xD6,0xA5,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xB6,0x67,0x2D,0x8E,0x35,0xCF,0x36,0x10,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x10,0x35,0xCF,0x35,0x8E,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xEE,0xE4,0x45,0x8D,0x35,0xCF,0x36,0x0F,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x0F,0x35,0xCF,0x5D,0xCC,0xFF,0x03,0xFF,0x03,0xFF,0x03,0x75,0xEA,0x2D,0xAE,0x35,0xEF,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x0F,0x35,0xAF,0x86,0x09,0xFF,0x03,0xFF,0x03,0xB6,0x67,0x2D,0x8E,0x35,0xCF,0x36,0x10,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x35,0xEF,0x2D,0x8E,0xAE,0x67,0xFF,0x03,0xEE,0xE4,0x3D,0xAD,0x35,0xCF,0x36,0x0F,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x35,0xEF,0x2D,0x8E,0xD6,0xA5,0xFF,0x03,0x75,0xEA,0x2D,0xAE,0x35,0xEF,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x10,0x35,0xCF,0x35,0x8E,0xFF,0x03,0xB6,0x67,0x2D,0x8E,0x35,0xEF,0x36,0x10,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x10,0x35,0xCF,0x4D,0xAC,0xEE,0xE4,0x3D,0x8D,0x35,0xCF,0x36,0x0F,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x10,0x35,0xCF,0x2D,0x8E,0x35,0x8E,0x2D,0xAE,0x35,0xEF,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x0F,0x35,0xEF,0x35,0xCF,0x35,0xEF,0x36,0x10,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x10,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x6E,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x2D,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x48,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x1B,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x1B,0x48,0x2D,0x6E,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x2D,0x6E,0x1B,0x48,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 const lv_img_dsc_t ui_img_battery101_png = {
     .header.always_zero = 0,
     .header.w = 48,
     .header.h = 48,
     .data_size = sizeof(ui_img_battery101_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_battery101_png_data
 };
-
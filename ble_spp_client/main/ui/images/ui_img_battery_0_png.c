@@ -10,51 +10,158 @@
 #endif
 
 // IMAGE DATA: assets/battery_0.png
+// Packed by tools/img_pack.py: RGB565, pre-blended on 0x000000
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_battery_0_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x59,0x4B,0xC6,0x59,0xE4,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xE3,0xC6,0x59,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xE3,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xBE,0x59,0xE2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xBA,0x06,0xBE,0x59,0x89,0xBE,0x59,0xE6,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xBE,0x59,0xE5,0xBE,0x59,0x88,0xD6,0xBA,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x59,0x88,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x59,0xE6,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xBE,0x59,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,
-    0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0xC6,0x59,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,
-    0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x4A,0xFC,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,
-    0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xEA,0x4A,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0x4E,0xC7,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,
-    0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xDB,0x4E,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0xF2,0x0C,0xDB,0x4E,0xC7,0xEA,0x4A,0xFC,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xE9,0xE9,0xFF,0xEA,0x4A,0xFC,0xDB,0x4E,0xC6,0xEB,0xF2,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE7,0xAD,0xB6,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xAD,0xB6,0x39,0xC7,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0xB6,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xA5,0x96,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x63,0x6D,0xAD,0xB7,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xAD,0xB6,0x63,0x6D,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x6D,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0x6B,0x4D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0xB7,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xAD,0xB7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,
+    0xC6,0x59,0xC6,0x59,0xC6,0x59,0xC6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,
+    0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,
+    0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,
+    0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,
+    0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,
+    0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,
+    0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x4A,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,
+    0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,
+    0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xEA,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x8B,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,
+    0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,
+    0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xAA,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0xAA,0x8B,0xEA,0x4A,0xE9,0xE9,
+    0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,
+    0xE9,0xE9,0xEA,0x4A,0xAA,0x8B,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 const lv_img_dsc_t ui_img_battery_0_png = {
     .header.always_zero = 0,
     .header.w = 48,
     .header.h = 48,
     .data_size = sizeof(ui_img_battery_0_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_battery_0_png_data
 };
-
@@ -10,51 +10,158 @@
 #endif
 
 // IMAGE DATA: assets/battery_100.png
+// Packed by tools/img_pack.py: RGB565, pre-blended on 0x000000
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_battery_100_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x4B,0x36,0x10,0xE4,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xE3,0x36,0x10,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x10,0xE3,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xE2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xAF,0x06,0x36,0x10,0x89,0x36,0x30,0xE6,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xE5,0x36,0x30,0x88,0x2E,0xAF,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x88,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xE6,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x10,0xE5,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x87,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,
-    0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xAF,0x06,0x36,0x30,0x87,0x36,0x10,0xE5,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x30,0xFF,0x36,0x10,0xE4,0x36,0x30,0x86,0x2E,0xAF,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x11,0xC5,0x2D,0x6E,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x2D,0x6E,0x11,0xC5,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x6E,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x2D,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x1B,0x49,0x2D,0x8E,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x2D,0x6E,0x1B,0x49,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x49,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x1B,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x8E,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x2D,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x6E,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x2D,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x48,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x1B,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x1B,0x48,0x2D,0x6E,0x36,0x30,
+    0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,0x36,0x30,
+    0x36,0x30,0x2D,0x6E,0x1B,0x48,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 const lv_img_dsc_t ui_img_battery_100_png = {
     .header.always_zero = 0,
     .header.w = 48,
     .header.h = 48,
     .data_size = sizeof(ui_img_battery_100_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_battery_100_png_data
 };
-
@@ -0,0 +1,135 @@
+#include "ui_cmd.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "ui_updater.h"
+#include "status_bar.h"
+#include "sleep.h"
+#include "lcd.h"
+#include "display_power.h"
+#include "diagnostics.h"
+
+#define TAG "UI_CMD"
+
+static QueueHandle_t ui_cmd_queue = NULL;
+
+// Refresh requests are a flag rather than queue entries, so telemetry
+// arriving faster than the LVGL task runs takes no room from other commands
+static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+static bool refresh_pending = false;
+
+esp_err_t ui_cmd_init(void) {
+    if (ui_cmd_queue != NULL) {
+        return ESP_OK;
+    }
+
+    ui_cmd_queue = xQueueCreate(UI_CMD_QUEUE_LENGTH, sizeof(ui_cmd_t));
+    if (ui_cmd_queue == NULL) {
+        ESP_LOGE(TAG, "Failed to create command queue");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+bool ui_cmd_post(const ui_cmd_t *cmd) {
+    if (ui_cmd_queue == NULL || cmd == NULL) {
+        return false;
+    }
+
+    // Nobody sees the labels with the panel off, and telemetry would keep
+    // waking the LVGL task. display_power refreshes them on wake.
+    if (cmd->type == UI_CMD_REFRESH_BINDINGS && display_power_is_off()) {
+        return true;
+    }
+
+    if (cmd->type == UI_CMD_REFRESH_BINDINGS) {
+        taskENTER_CRITICAL(&lock);
+        bool was_pending = refresh_pending;
+        refresh_pending = true;
+        taskEXIT_CRITICAL(&lock);
+
+        // The LVGL task is awake or already notified for the pending one
+        if (!was_pending) {
+            lcd_wake();
+        }
+        return true;
+    }
+
+    if (xQueueSend(ui_cmd_queue, cmd, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "Command queue full, dropping command %d", cmd->type);
+        return false;
+    }
+    lcd_wake();
+    return true;
+}
+
+bool ui_cmd_load_screen(ui_screen_t screen) {
+    ui_cmd_t cmd = {
+        .type = UI_CMD_LOAD_SCREEN,
+        .screen = screen,
+    };
+    return ui_cmd_post(&cmd);
+}
+
+bool ui_cmd_set_value(lv_obj_t **obj, int32_t value) {
+    ui_cmd_t cmd = {
+        .type = UI_CMD_SET_VALUE,
+        .set_value = { .obj = obj, .value = value },
+    };
+    return ui_cmd_post(&cmd);
+}
+
+bool ui_cmd_simple(ui_cmd_type_t type) {
+    ui_cmd_t cmd = { .type = type };
+    return ui_cmd_post(&cmd);
+}
+
+void ui_cmd_process(void) {
+    ui_cmd_t cmd;
+    bool refresh = false;
+
+    if (ui_cmd_queue == NULL) {
+        return;
+    }
+
+    // Cleared before the refresh runs, a request after this gets another pass
+    taskENTER_CRITICAL(&lock);
+    refresh = refresh_pending;
+    refresh_pending = false;
+    taskEXIT_CRITICAL(&lock);
+
+    // Apply everything that is queued; LVGL merges the resulting invalidations
+    // into the next lv_timer_handler() render pass
+    while (xQueueReceive(ui_cmd_queue, &cmd, 0) == pdTRUE) {
+        switch (cmd.type) {
+            case UI_CMD_LOAD_SCREEN:
+                screen_manager_load(cmd.screen);
+                // Fill the new screen's labels right away
+                refresh = true;
+                break;
+            case UI_CMD_SET_VALUE:
+                if (cmd.set_value.obj != NULL && *cmd.set_value.obj != NULL) {
+                    lv_bar_set_value(*cmd.set_value.obj, cmd.set_value.value, LV_ANIM_OFF);
+                }
+                break;
+            case UI_CMD_REFRESH_BINDINGS:
+                // Posted through refresh_pending, never queued
+                break;
+            case UI_CMD_START_SHUTDOWN:
+                screen_manager_load(UI_SCREEN_SHUTDOWN);
+                sleep_start_shutdown_animation();
+                break;
+            case UI_CMD_CANCEL_SHUTDOWN:
+                if (sleep_cancel_shutdown_animation()) {
+                    screen_manager_load(UI_SCREEN_HOME);
+                }
+                break;
+        }
+    }
+
+    if (refresh) {
+        ui_updater_refresh();
+        status_bar_refresh();
+        diagnostics_bindings_refreshed();
+    }
+}
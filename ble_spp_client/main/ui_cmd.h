@@ -0,0 +1,47 @@
+#ifndef UI_CMD_H
+#define UI_CMD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "lvgl.h"
+#include "screen_manager.h"
+
+#define UI_CMD_QUEUE_LENGTH 16
+
+typedef enum {
+    UI_CMD_LOAD_SCREEN,        // Show a screen
+    UI_CMD_SET_VALUE,          // Set the value of a bar widget
+    UI_CMD_REFRESH_BINDINGS,   // Push telemetry to the bound labels
+    UI_CMD_START_SHUTDOWN,     // Show the shutdown screen and start its animation
+    UI_CMD_CANCEL_SHUTDOWN     // Stop the shutdown animation if it is running
+} ui_cmd_type_t;
+
+typedef struct {
+    ui_cmd_type_t type;
+    union {
+        ui_screen_t screen;
+        struct {
+            lv_obj_t **obj;    // Address of the SquareLine widget pointer
+            int32_t value;
+        } set_value;
+    };
+} ui_cmd_t;
+
+// Create the command queue, must be called before any other ui_cmd function
+esp_err_t ui_cmd_init(void);
+
+// Queue a command from any task, returns false if the queue is full.
+// Refresh requests do not use the queue, they coalesce until the LVGL task
+// applies them.
+bool ui_cmd_post(const ui_cmd_t *cmd);
+
+// Convenience wrappers around ui_cmd_post
+bool ui_cmd_load_screen(ui_screen_t screen);
+bool ui_cmd_set_value(lv_obj_t **obj, int32_t value);
+bool ui_cmd_simple(ui_cmd_type_t type);
+
+// Drain and apply all queued commands. Must only be called from the LVGL task.
+void ui_cmd_process(void);
+
+#endif // UI_CMD_H
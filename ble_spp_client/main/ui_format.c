@@ -0,0 +1,88 @@
+#include "ui_format.h"
+#include <stdbool.h>
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "lvgl.h"
+
+#define TAG "UI_FORMAT"
+#define MAX_DECIMALS 9
+#define BENCHMARK_ITERATIONS 500
+
+size_t ui_format_fixed(char *buf, size_t len, int32_t value, uint8_t decimals, const char *suffix) {
+    char digits[12];
+    size_t count = 0;
+    size_t pos = 0;
+    bool negative = value < 0;
+    uint32_t magnitude = negative ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+
+    if (buf == NULL || len == 0) {
+        return 0;
+    }
+    if (decimals > MAX_DECIMALS) {
+        decimals = MAX_DECIMALS;
+    }
+
+    // Collect digits least significant first, keeping the leading zero of "0.x"
+    do {
+        digits[count++] = '0' + (magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0 || count <= decimals);
+
+    if (negative && pos < len - 1) {
+        buf[pos++] = '-';
+    }
+    while (count > 0 && pos < len - 1) {
+        buf[pos++] = digits[--count];
+        if (count == decimals && count > 0 && pos < len - 1) {
+            buf[pos++] = '.';
+        }
+    }
+    while (suffix != NULL && *suffix != '\0' && pos < len - 1) {
+        buf[pos++] = *suffix++;
+    }
+    buf[pos] = '\0';
+
+    return pos;
+}
+
+static void log_mem(const char *stage, const lv_mem_monitor_t *before, const lv_mem_monitor_t *after,
+                    uint32_t cycles) {
+    ESP_LOGI(TAG, "%s: %lu cycles/update, used %lu -> %lu bytes, frag %u%% -> %u%%, biggest free %lu -> %lu",
+             stage, (unsigned long)(cycles / BENCHMARK_ITERATIONS),
+             (unsigned long)(before->total_size - before->free_size),
+             (unsigned long)(after->total_size - after->free_size),
+             before->frag_pct, after->frag_pct,
+             (unsigned long)before->free_biggest_size, (unsigned long)after->free_biggest_size);
+}
+
+void ui_format_benchmark(void) {
+    static char text[16];
+    lv_mem_monitor_t before;
+    lv_mem_monitor_t after;
+    uint32_t start;
+
+    lv_obj_t *label = lv_label_create(lv_layer_sys());
+
+    // Current path: printf-style formatting into an LVGL-allocated string
+    lv_mem_monitor(&before);
+    start = esp_cpu_get_cycle_count();
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        lv_label_set_text_fmt(label, "%.1fv", (float)(400 + i) / 10.0f);
+    }
+    uint32_t fmt_cycles = esp_cpu_get_cycle_count() - start;
+    lv_mem_monitor(&after);
+    log_mem("lv_label_set_text_fmt", &before, &after, fmt_cycles);
+
+    // Fixed-point path: integer formatting into a static buffer
+    lv_mem_monitor(&before);
+    start = esp_cpu_get_cycle_count();
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        ui_format_fixed(text, sizeof(text), 400 + i, 1, "v");
+        lv_label_set_text_static(label, text);
+    }
+    uint32_t fixed_cycles = esp_cpu_get_cycle_count() - start;
+    lv_mem_monitor(&after);
+    log_mem("ui_format_fixed", &before, &after, fixed_cycles);
+
+    lv_obj_del(label);
+}
@@ -0,0 +1,18 @@
+#ifndef UI_FORMAT_H
+#define UI_FORMAT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Set to 1 to compare the fixed-point path against lv_label_set_text_fmt at startup
+#define UI_FORMAT_BENCHMARK 0
+
+// Write a fixed-point value followed by an optional unit suffix.
+// value is scaled by 10^decimals, e.g. 123 with 1 decimal gives "12.3".
+// Returns the number of characters written, excluding the terminator.
+size_t ui_format_fixed(char *buf, size_t len, int32_t value, uint8_t decimals, const char *suffix);
+
+// Run the formatting benchmark and log the results (LVGL must be initialised)
+void ui_format_benchmark(void);
+
+#endif // UI_FORMAT_H
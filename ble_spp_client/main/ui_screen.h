@@ -0,0 +1,15 @@
+#ifndef UI_SCREEN_H
+#define UI_SCREEN_H
+
+// Screens that can be requested through the command bus. Without LVGL, so
+// the modules that only pick a screen stay free of it.
+typedef enum {
+    UI_SCREEN_SPLASH,
+    UI_SCREEN_HOME,
+    UI_SCREEN_DETAILED,
+    UI_SCREEN_SHUTDOWN,
+    UI_SCREEN_DIAGNOSTICS,
+    UI_SCREEN_MAX
+} ui_screen_t;
+
+#endif // UI_SCREEN_H
@@ -1,58 +1,123 @@
 #include "ui_updater.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "esp_log.h"
-#include "adc.h"
+#include "ble_spp_client.h"
+#include "vesc_config.h"
+#include "ui_format.h"
+#include "trip.h"
 
 #define TAG "UI_UPDATER"
 
-static lv_obj_t* get_current_screen(void) {
-    return lv_scr_act();
+typedef struct {
+    bool valid;                       // false until the label shows this binding's value
+    int32_t last_value;
+    TickType_t last_update;
+    char text[UI_BINDING_TEXT_LEN];   // Static text buffer referenced by the label
+} ui_binding_state_t;
+
+// Follows config changes, the factor is worked out when the config is saved
+static int32_t read_speed(void) {
+    return vesc_config_get_speed(VESC_SPEED_KMH);
 }
 
-void ui_updater_init(void) {
-    // Any initialization code if needed
+static void format_speed(char *buf, size_t len, int32_t value) {
+    ui_format_fixed(buf, len, value, 0, NULL);
 }
 
-void ui_update_speed(int32_t value) {
-    if (ui_Label1 == NULL) return;
+static void format_decivolts(char *buf, size_t len, int32_t value) {
+    ui_format_fixed(buf, len, value, 1, "v");
+}
 
-    // Only update if home screen is active
-    if (get_current_screen() == ui_home_screen) {
-        lv_label_set_text_fmt(ui_Label1, "%ld", value);
-    }
+static void format_deciamps(char *buf, size_t len, int32_t value) {
+    ui_format_fixed(buf, len, value, 1, "a");
 }
 
-void ui_update_battery_voltage(float voltage) {
-    if (ui_vesc_voltage == NULL) return;
+static void format_hectometres(char *buf, size_t len, int32_t value) {
+    ui_format_fixed(buf, len, value, 1, "km");
+}
 
-    // Only update if detailed screen is active
-    if (get_current_screen() == ui_detailed_home) {
-        lv_label_set_text_fmt(ui_vesc_voltage, "%.1fv", voltage);
+// -1 until the trip is long enough
+static void format_efficiency(char *buf, size_t len, int32_t value) {
+    if (value < 0) {
+        snprintf(buf, len, "--wh/km");
+        return;
     }
+    ui_format_fixed(buf, len, value, 1, "wh/km");
 }
 
-void ui_update_motor_current(float current) {
-    if (ui_vesc_motor_current == NULL) return;
+static const ui_binding_t bindings[] = {
+    // Home screen
+    { &ui_Label1, &ui_home_screen, read_speed, format_speed, 1, 100 },
+    { &ui_Label5, &ui_home_screen, trip_get_distance_hm, format_hectometres, 1, 1000 },
 
-    // Only update if detailed screen is active
-    if (get_current_screen() == ui_detailed_home) {
-        lv_label_set_text_fmt(ui_vesc_motor_current, "%.1fa", current);
-    }
+    // Detailed screen
+    { &ui_vesc_voltage, &ui_detailed_home, get_latest_voltage_dv, format_decivolts, 1, 250 },
+    { &ui_vesc_motor_current, &ui_detailed_home, get_latest_current_motor_da, format_deciamps, 1, 250 },
+    { &ui_battery_current, &ui_detailed_home, get_latest_current_in_da, format_deciamps, 1, 250 },
+    { &ui_vesc_consumption, &ui_detailed_home, trip_get_efficiency_dwh_km, format_efficiency, 1, 1000 },
+};
+
+#define BINDING_COUNT (sizeof(bindings) / sizeof(bindings[0]))
+
+static ui_binding_state_t binding_states[BINDING_COUNT];
+static lv_obj_t *last_screen = NULL;
+
+void ui_updater_init(void) {
+    memset(binding_states, 0, sizeof(binding_states));
+    last_screen = NULL;
+
+#if UI_FORMAT_BENCHMARK
+    ui_format_benchmark();
+#endif
 }
 
-void ui_update_battery_current(float current) {
-    if (ui_battery_current == NULL) return;
+void ui_updater_refresh(void) {
+    lv_obj_t *screen = lv_scr_act();
+    TickType_t now = xTaskGetTickCount();
 
-    // Only update if detailed screen is active
-    if (get_current_screen() == ui_detailed_home) {
-        lv_label_set_text_fmt(ui_battery_current, "%.1fa", current);
+    // Labels of a newly shown screen may hold stale text, redraw them all once
+    if (screen != last_screen) {
+        for (size_t i = 0; i < BINDING_COUNT; i++) {
+            binding_states[i].valid = false;
+        }
+        last_screen = screen;
     }
-}
 
-void ui_update_consumption(float consumption) {
-    if (ui_vesc_consumption == NULL) return;
+    for (size_t i = 0; i < BINDING_COUNT; i++) {
+        const ui_binding_t *binding = &bindings[i];
+        ui_binding_state_t *state = &binding_states[i];
+
+        if (*binding->label == NULL || *binding->screen != screen) {
+            continue;
+        }
+
+        if (state->valid &&
+            (now - state->last_update) * portTICK_PERIOD_MS < binding->min_interval_ms) {
+            continue;
+        }
 
-    // Only update if detailed screen is active
-    if (get_current_screen() == ui_detailed_home) {
-        lv_label_set_text_fmt(ui_vesc_consumption, "%.1fwh", consumption);
+        int32_t value = binding->read();
+        if (state->valid && abs(value - state->last_value) < binding->threshold) {
+            continue;
+        }
+
+        char text[UI_BINDING_TEXT_LEN];
+        binding->format(text, sizeof(text), value);
+        state->last_value = value;
+        state->last_update = now;
+
+        // Skip the relayout when the formatted output did not change
+        if (state->valid && strcmp(text, state->text) == 0) {
+            continue;
+        }
+
+        // The label references the static buffer, so LVGL allocates nothing here
+        strcpy(state->text, text);
+        lv_label_set_text_static(*binding->label, state->text);
+        state->valid = true;
     }
-}
\ No newline at end of file
+}
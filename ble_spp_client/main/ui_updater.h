@@ -2,16 +2,28 @@
 #define UI_UPDATER_H
 
 #include <stdint.h>
+#include <stddef.h>
 #include "ui/ui.h"
 
+#define UI_BINDING_TEXT_LEN 16
+
+// Formats a fixed-point telemetry value into the label text buffer
+typedef void (*ui_format_cb_t)(char *buf, size_t len, int32_t value);
+
+// Binds one label to one telemetry field
+typedef struct {
+    lv_obj_t **label;          // Label updated by this binding
+    lv_obj_t **screen;         // Screen the label lives on
+    int32_t (*read)(void);     // Telemetry source, in the unit the formatter expects
+    ui_format_cb_t format;     // Turns the value into label text
+    int32_t threshold;         // Minimum change before the label is re-formatted
+    uint32_t min_interval_ms;  // Minimum time between two label updates
+} ui_binding_t;
+
 // Function to initialize the UI updater
 void ui_updater_init(void);
 
-// Functions to update specific UI elements
-void ui_update_speed(int32_t value);
-void ui_update_battery_voltage(float voltage);
-void ui_update_motor_current(float current);
-void ui_update_battery_current(float current);
-void ui_update_consumption(float consumption);
+// Refresh the bindings of the active screen whose value changed
+void ui_updater_refresh(void);
 
-#endif // UI_UPDATER_H 
\ No newline at end of file
+#endif // UI_UPDATER_H
@@ -1,101 +1,68 @@
 #include "vesc_config.h"
-#include "nvs_flash.h"
-#include "nvs.h"
 #include "esp_log.h"
 #include "ble_spp_client.h"
+#include "settings.h"
 
 static const char *TAG = "VESC_CONFIG";
 
-// Default configuration values
-static const vesc_config_t default_config = {
-    .motor_pulley = 15,        // 15T motor pulley
-    .wheel_pulley = 36,        // 36T wheel pulley
-    .wheel_diameter_mm = 83,   // 83mm wheels
-    .motor_poles = 14,         // 14 pole motor
-    .invert_throttle = false   // Normal throttle direction
-};
+static vesc_config_t current;
+static vesc_speed_factors_t factors;
+static vesc_config_listener_t listeners[VESC_CONFIG_MAX_LISTENERS];
+static size_t listener_count = 0;
 
-esp_err_t vesc_config_init(void) {
-    // Try to load config, if it fails (first time) save defaults
-    vesc_config_t config;
-    esp_err_t err = vesc_config_load(&config);
-    
-    if (err == ESP_ERR_NVS_NOT_FOUND) {
-        ESP_LOGI(TAG, "No configuration found, saving defaults");
-        return vesc_config_save(&default_config);
+// Work out what the hot paths need from a config, once per change
+static void apply(const vesc_config_t *config) {
+    current = *config;
+    if (!vesc_speed_factors(config->motor_pulley, config->wheel_pulley, config->wheel_diameter_mm,
+                            config->motor_poles, &factors)) {
+        ESP_LOGE(TAG, "Invalid gearing (%u:%u teeth, %u mm, %u poles), speed reads 0", config->motor_pulley,
+                 config->wheel_pulley, config->wheel_diameter_mm, config->motor_poles);
     }
-    
-    return err;
 }
 
-esp_err_t vesc_config_load(vesc_config_t *config) {
-    nvs_handle_t nvs_handle;
-    esp_err_t err;
-
-    err = nvs_open(VESC_NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
-    if (err != ESP_OK) return err;
+static void notify(void) {
+    for (size_t i = 0; i < listener_count; i++) {
+        listeners[i](&current);
+    }
+}
 
-    // Load each value, with error checking
-    err = nvs_get_u8(nvs_handle, NVS_KEY_MOTOR_PULLEY, &config->motor_pulley);
-    if (err != ESP_OK) goto cleanup;
-    
-    err = nvs_get_u8(nvs_handle, NVS_KEY_WHEEL_PULLEY, &config->wheel_pulley);
-    if (err != ESP_OK) goto cleanup;
-    
-    err = nvs_get_u8(nvs_handle, NVS_KEY_WHEEL_DIAM, &config->wheel_diameter_mm);
-    if (err != ESP_OK) goto cleanup;
-    
-    err = nvs_get_u8(nvs_handle, NVS_KEY_MOTOR_POLES, &config->motor_poles);
-    if (err != ESP_OK) goto cleanup;
-    
-    uint8_t inv_throttle;
-    err = nvs_get_u8(nvs_handle, NVS_KEY_INV_THROT, &inv_throttle);
-    if (err != ESP_OK) goto cleanup;
-    config->invert_throttle = (bool)inv_throttle;
+esp_err_t vesc_config_init(void) {
+    settings_t settings;
 
-cleanup:
-    nvs_close(nvs_handle);
-    return err;
+    // Read once at boot by the settings, defaults included
+    settings_get(&settings);
+    apply(&settings.vesc);
+    return ESP_OK;
 }
 
 esp_err_t vesc_config_save(const vesc_config_t *config) {
-    nvs_handle_t nvs_handle;
-    esp_err_t err;
-
-    err = nvs_open(VESC_NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
-    if (err != ESP_OK) return err;
+    settings_set_vesc(config);
+    apply(config);
+    notify();
+    return ESP_OK;
+}
 
-    // Save each value
-    err = nvs_set_u8(nvs_handle, NVS_KEY_MOTOR_PULLEY, config->motor_pulley);
-    if (err != ESP_OK) goto cleanup;
-    
-    err = nvs_set_u8(nvs_handle, NVS_KEY_WHEEL_PULLEY, config->wheel_pulley);
-    if (err != ESP_OK) goto cleanup;
-    
-    err = nvs_set_u8(nvs_handle, NVS_KEY_WHEEL_DIAM, config->wheel_diameter_mm);
-    if (err != ESP_OK) goto cleanup;
-    
-    err = nvs_set_u8(nvs_handle, NVS_KEY_MOTOR_POLES, config->motor_poles);
-    if (err != ESP_OK) goto cleanup;
-    
-    err = nvs_set_u8(nvs_handle, NVS_KEY_INV_THROT, (uint8_t)config->invert_throttle);
-    if (err != ESP_OK) goto cleanup;
+void vesc_config_get(vesc_config_t *config) {
+    *config = current;
+}
 
-    err = nvs_commit(nvs_handle);
+esp_err_t vesc_config_subscribe(vesc_config_listener_t listener) {
+    if (listener_count >= VESC_CONFIG_MAX_LISTENERS) {
+        return ESP_ERR_NO_MEM;
+    }
+    listeners[listener_count++] = listener;
+    return ESP_OK;
+}
 
-cleanup:
-    nvs_close(nvs_handle);
-    return err;
+int32_t vesc_config_speed(int32_t erpm, vesc_speed_unit_t unit) {
+    return vesc_speed_from_erpm(erpm, factors.speed[unit]);
 }
 
+int32_t vesc_config_get_speed(vesc_speed_unit_t unit) {
+    return vesc_config_speed(get_latest_erpm(), unit);
+}
 
-int32_t vesc_config_get_speed(const vesc_config_t *config) {
-    int32_t erpm = get_latest_erpm();
-    int32_t rpm = erpm/config->motor_poles; 
-    float gear_ratio = (float)config->wheel_pulley / (float)config->motor_pulley;
-    float wheel_circumference_m = (float)config->wheel_diameter_mm / 1000.0f * 3.14159f;
-    float wheel_RPM = rpm * gear_ratio;
-    float speed = wheel_RPM * wheel_circumference_m * 60.0f / 1000.0f;
+uint32_t vesc_config_nm_per_erev(void) {
+    return factors.nm_per_erev;
+}
 
-    return (int32_t)speed;
-} 
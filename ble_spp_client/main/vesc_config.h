@@ -4,26 +4,37 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "esp_err.h"
-
-// NVS Storage keys
-#define VESC_NVS_NAMESPACE "vesc_cfg"
-#define NVS_KEY_MOTOR_PULLEY "mot_pulley"
-#define NVS_KEY_WHEEL_PULLEY "wheel_pulley"
-#define NVS_KEY_WHEEL_DIAM "wheel_diam"
-#define NVS_KEY_MOTOR_POLES "motor_poles"
-#define NVS_KEY_INV_THROT "inv_throttle"
+#include "vesc_speed.h"
 
 typedef struct {
     uint8_t motor_pulley;      // Number of teeth on motor pulley
     uint8_t wheel_pulley;      // Number of teeth on wheel pulley
     uint8_t wheel_diameter_mm; // Wheel diameter in millimeters
-    uint8_t motor_poles;      // Number of motor poles
+    uint8_t motor_poles;      // Number of magnet poles, twice the pole pairs the eRPM is counted in
     bool invert_throttle;     // Whether to invert the throttle direction
 } vesc_config_t;
 
+// Called with the new config after every save, on the saving task
+typedef void (*vesc_config_listener_t)(const vesc_config_t *config);
+#define VESC_CONFIG_MAX_LISTENERS 4
+
+// Stored as part of settings.h, after settings_init()
 esp_err_t vesc_config_init(void);
-esp_err_t vesc_config_load(vesc_config_t *config);
+// Takes effect right away, written to NVS with the next settings save
 esp_err_t vesc_config_save(const vesc_config_t *config);
-int32_t vesc_config_get_speed(const vesc_config_t *config);
+
+// Config in use, without reading NVS. Any task, after vesc_config_init().
+void vesc_config_get(vesc_config_t *config);
+esp_err_t vesc_config_subscribe(vesc_config_listener_t listener);
+
+// Speed in whole units from the factor worked out when the config was
+// loaded or saved, one multiply and shift. 0 when the gearing is invalid.
+int32_t vesc_config_speed(int32_t erpm, vesc_speed_unit_t unit);
+// Same for the latest eRPM from the controller
+int32_t vesc_config_get_speed(vesc_speed_unit_t unit);
+
+// Distance per electrical turn in nm, for integrating the eRPM. 0 when the
+// gearing is invalid.
+uint32_t vesc_config_nm_per_erev(void);
 
 #endif // VESC_CONFIG_H 
\ No newline at end of file
@@ -0,0 +1,37 @@
+#include "vesc_speed.h"
+#include <string.h>
+
+#define KM_PER_MILE 1.609344
+#define PI 3.14159265358979323846  // M_PI is not in strict C
+
+bool vesc_speed_factors(uint8_t motor_pulley, uint8_t wheel_pulley, uint8_t wheel_diameter_mm, uint8_t motor_poles,
+                        vesc_speed_factors_t *out) {
+    // eRPM counts electrical turns, one per pole pair per motor turn
+    uint32_t pole_pairs = motor_poles / 2;
+
+    memset(out, 0, sizeof(*out));
+    if (pole_pairs == 0 || motor_poles % 2 != 0 || motor_pulley == 0 || wheel_pulley == 0 || wheel_diameter_mm == 0) {
+        return false;
+    }
+
+    // Wheel turns per electrical turn, then its circumference in m
+    double wheel_turns = (double)motor_pulley / ((double)pole_pairs * wheel_pulley);
+    double metres = wheel_turns * wheel_diameter_mm * PI / 1000.0;
+    double kmh_per_erpm = metres * 60.0 / 1000.0;
+    double nm = metres * 1e9 + 0.5;
+    if (nm >= 4294967296.0) {
+        return false;
+    }
+
+    out->speed[VESC_SPEED_KMH] = (uint32_t)(kmh_per_erpm * (1 << VESC_SPEED_SHIFT) + 0.5);
+    out->speed[VESC_SPEED_MPH] = (uint32_t)(kmh_per_erpm / KM_PER_MILE * (1 << VESC_SPEED_SHIFT) + 0.5);
+    out->nm_per_erev = (uint32_t)nm;
+    return true;
+}
+
+int32_t vesc_speed_from_erpm(int32_t erpm, uint32_t factor) {
+    uint64_t magnitude = erpm < 0 ? (uint64_t)(-(int64_t)erpm) : (uint64_t)erpm;
+    int32_t speed = (int32_t)((magnitude * factor) >> VESC_SPEED_SHIFT);
+
+    return erpm < 0 ? -speed : speed;
+}
@@ -0,0 +1,33 @@
+#ifndef VESC_SPEED_H
+#define VESC_SPEED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// eRPM to speed and distance conversion. It has no hardware or RTOS
+// dependencies, vesc_config works the factors out once per config change.
+
+typedef enum {
+    VESC_SPEED_KMH,
+    VESC_SPEED_MPH,
+    VESC_SPEED_UNIT_COUNT
+} vesc_speed_unit_t;
+
+// Fraction bits of the eRPM to speed factors
+#define VESC_SPEED_SHIFT 24
+
+typedef struct {
+    uint32_t speed[VESC_SPEED_UNIT_COUNT];  // Speed per eRPM, VESC_SPEED_SHIFT fraction bits
+    uint32_t nm_per_erev;                   // Distance per electrical turn in nm
+} vesc_speed_factors_t;
+
+// motor_poles counts magnet poles, the eRPM is counted per pole pair. False
+// with all factors 0 when the gearing is invalid, or when one electrical
+// turn covers more than UINT32_MAX nm (4.29 m).
+bool vesc_speed_factors(uint8_t motor_pulley, uint8_t wheel_pulley, uint8_t wheel_diameter_mm, uint8_t motor_poles,
+                        vesc_speed_factors_t *out);
+
+// Whole units, truncated towards zero, one multiply and shift
+int32_t vesc_speed_from_erpm(int32_t erpm, uint32_t factor);
+
+#endif // VESC_SPEED_H
@@ -0,0 +1,22 @@
+#include "vesc_telemetry.h"
+
+static int16_t get_i16(const uint8_t *p) {
+    return (int16_t)((p[0] << 8) | p[1]);
+}
+
+static int32_t get_i32(const uint8_t *p) {
+    return (int32_t)(((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3]);
+}
+
+bool vesc_telemetry_decode(const uint8_t *data, size_t len, vesc_telemetry_t *out) {
+    if (len != VESC_TELEMETRY_LEN) {
+        return false;
+    }
+    out->voltage_cv = get_i16(data + 0);
+    out->erpm = get_i32(data + 2);
+    out->current_motor_ca = get_i16(data + 6);
+    out->current_in_ca = get_i16(data + 8);
+    out->amp_hours_cah = get_i16(data + 10);
+    out->amp_hours_charged_cah = get_i16(data + 12);
+    return true;
+}
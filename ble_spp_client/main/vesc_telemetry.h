@@ -0,0 +1,27 @@
+#ifndef VESC_TELEMETRY_H
+#define VESC_TELEMETRY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Decoder for the telemetry notification of the SPP server. It has no
+// hardware or RTOS dependencies, the GATT client hands it the payload.
+
+// Big endian: voltage (2), eRPM (4), motor current (2), input current (2),
+// amp hours (2), amp hours charged (2)
+#define VESC_TELEMETRY_LEN 14
+
+typedef struct {
+    int16_t voltage_cv;
+    int32_t erpm;
+    int16_t current_motor_ca;
+    int16_t current_in_ca;
+    int16_t amp_hours_cah;
+    int16_t amp_hours_charged_cah;
+} vesc_telemetry_t;
+
+// False and out untouched when the payload has the wrong length
+bool vesc_telemetry_decode(const uint8_t *data, size_t len, vesc_telemetry_t *out);
+
+#endif // VESC_TELEMETRY_H
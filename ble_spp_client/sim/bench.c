@@ -0,0 +1,101 @@
+// Micro-benchmark of the pure control path modules, on the host:
+//     cmake -S sim -B build-sim && cmake --build build-sim
+//     build-sim/control_bench [iterations]
+//
+// Each function runs over a table of varied inputs, so neither the branch
+// predictor nor the compiler sees one constant, and the results are summed
+// into a volatile. Prints ns per call. The numbers are for the host CPU,
+// use them to compare two versions of a module, not as ESP32-C3 timings.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "inactivity.h"
+#include "throttle_map.h"
+#include "vesc_speed.h"
+#include "vesc_telemetry.h"
+
+#define INPUTS 1024  // Power of two, indexed with a mask
+#define DEFAULT_ITERATIONS 20000000L
+
+static uint32_t raw_values[INPUTS];
+static int32_t erpm_values[INPUTS];
+static uint32_t times_ms[INPUTS];
+static uint8_t frames[INPUTS][VESC_TELEMETRY_LEN];
+
+static volatile int64_t sink;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void report(const char *name, double start_ns, long iterations) {
+    printf("%-24s %7.2f ns/op\n", name, (now_ns() - start_ns) / iterations);
+}
+
+int main(int argc, char **argv) {
+    long iterations = argc > 1 ? atol(argv[1]) : DEFAULT_ITERATIONS;
+    if (iterations <= 0) {
+        fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    srand(1);
+    for (int i = 0; i < INPUTS; i++) {
+        raw_values[i] = (uint32_t)(rand() % 4096);
+        erpm_values[i] = (rand() % 200001) - 100000;
+        times_ms[i] = (uint32_t)rand();
+        for (int j = 0; j < VESC_TELEMETRY_LEN; j++) {
+            frames[i][j] = (uint8_t)rand();
+        }
+    }
+
+    vesc_speed_factors_t factors;
+    vesc_speed_factors(15, 36, 83, 14, &factors);
+
+    int64_t sum = 0;
+    double start = now_ns();
+    for (long i = 0; i < iterations; i++) {
+        sum += throttle_map(raw_values[i & (INPUTS - 1)], 1100, 3300);
+    }
+    report("throttle_map", start, iterations);
+
+    start = now_ns();
+    for (long i = 0; i < iterations; i++) {
+        vesc_telemetry_t t;
+        vesc_telemetry_decode(frames[i & (INPUTS - 1)], VESC_TELEMETRY_LEN, &t);
+        sum += t.erpm + t.voltage_cv;
+    }
+    report("vesc_telemetry_decode", start, iterations);
+
+    start = now_ns();
+    for (long i = 0; i < iterations; i++) {
+        sum += vesc_speed_from_erpm(erpm_values[i & (INPUTS - 1)], factors.speed[VESC_SPEED_KMH]);
+    }
+    report("vesc_speed_from_erpm", start, iterations);
+
+    // Once per config change, fewer runs
+    long factor_iterations = iterations / 100 > 0 ? iterations / 100 : 1;
+    start = now_ns();
+    for (long i = 0; i < factor_iterations; i++) {
+        vesc_speed_factors(15, (uint8_t)(36 + (i & 7)), 83, 14, &factors);
+        sum += factors.nm_per_erev;
+    }
+    report("vesc_speed_factors", start, factor_iterations);
+
+    inactivity_t idle;
+    inactivity_init(&idle, 60000, 1000, 0);
+    start = now_ns();
+    for (long i = 0; i < iterations; i++) {
+        uint32_t now = times_ms[i & (INPUTS - 1)];
+        inactivity_reset(&idle, now);
+        sum += inactivity_expired(&idle, now + 1, false);
+    }
+    report("inactivity_reset+expired", start, iterations);
+
+    sink = sum;
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <string.h>
+#include "lvgl.h"
+#include "sim.h"
+
+// Same draw buffers as lcd.c, two of 1/16 of the screen, so the flush
+// count and partial refresh match the panel
+#define DRAW_BUF_PIXELS (SIM_HOR_RES * (SIM_VER_RES / 16))
+
+static lv_disp_draw_buf_t draw_buf;
+static lv_color_t buf1[DRAW_BUF_PIXELS];
+static lv_color_t buf2[DRAW_BUF_PIXELS];
+static lv_disp_drv_t disp_drv;
+static uint16_t framebuffer[SIM_HOR_RES * SIM_VER_RES];
+
+// Counted since sim_display_begin()
+static bool rendered;
+static uint32_t area_px;
+static uint32_t flushes;
+static uint32_t flushed_px;
+
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
+    lv_coord_t w = lv_area_get_width(area);
+
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&framebuffer[y * SIM_HOR_RES + area->x1], color_map, w * sizeof(lv_color_t));
+        color_map += w;
+    }
+    flushes++;
+    flushed_px += lv_area_get_size(area);
+    lv_disp_flush_ready(drv);
+}
+
+// Called by LVGL once a frame is drawn, px is the invalidated area
+static void monitor_cb(lv_disp_drv_t *drv, uint32_t time, uint32_t px) {
+    rendered = true;
+    area_px += px;
+}
+
+void sim_display_init(void) {
+    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, DRAW_BUF_PIXELS);
+
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.monitor_cb = monitor_cb;
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.hor_res = SIM_HOR_RES;
+    disp_drv.ver_res = SIM_VER_RES;
+    lv_disp_drv_register(&disp_drv);
+}
+
+const uint16_t *sim_display_framebuffer(void) {
+    return framebuffer;
+}
+
+void sim_display_begin(void) {
+    rendered = false;
+    area_px = 0;
+    flushes = 0;
+    flushed_px = 0;
+}
+
+bool sim_display_end(sim_frame_t *frame) {
+    if (!rendered) {
+        return false;
+    }
+    frame->at_ms = sim_clock_ms();
+    frame->area_px = area_px;
+    frame->flushes = flushes;
+    frame->flushed_px = flushed_px;
+    return true;
+}
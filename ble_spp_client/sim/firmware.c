@@ -0,0 +1,174 @@
+#include <stdbool.h>
+#include <string.h>
+#include "sim.h"
+#include "ble_spp_client.h"
+#include "adc.h"
+#include "trip.h"
+#include "vesc_config.h"
+#include "diagnostics.h"
+#include "resume.h"
+
+// Default gearing of settings.c
+#define SIM_MOTOR_PULLEY 15
+#define SIM_WHEEL_PULLEY 36
+#define SIM_WHEEL_DIAMETER_MM 83
+#define SIM_MOTOR_POLES 14
+
+bool is_connect = false;
+
+static int32_t connection_quality;
+static int32_t voltage_dv;
+static int32_t erpm;
+static int32_t current_motor_da;
+static int32_t current_in_da;
+static int32_t amp_hours_cah;
+static int32_t battery_percent = 100;
+static int32_t connected;
+static int32_t trip_hm;
+static int32_t trip_energy_dwh;
+static int32_t trip_efficiency = -1;  // -1 until the trip is long enough
+static int32_t trip_range_hm = -1;
+static int32_t odometer_km;
+static ui_screen_t resume_screen = UI_SCREEN_HOME;
+
+static const struct {
+    const char *name;
+    int32_t *value;
+} fields[] = {
+    { "connected", &connected },
+    { "link", &connection_quality },
+    { "voltage_dv", &voltage_dv },
+    { "erpm", &erpm },
+    { "motor_da", &current_motor_da },
+    { "in_da", &current_in_da },
+    { "ah_cah", &amp_hours_cah },
+    { "battery", &battery_percent },
+    { "trip_hm", &trip_hm },
+    { "energy_dwh", &trip_energy_dwh },
+    { "wh_km", &trip_efficiency },
+    { "range_hm", &trip_range_hm },
+    { "odometer_km", &odometer_km },
+};
+
+#define FIELD_COUNT (sizeof(fields) / sizeof(fields[0]))
+
+const char *sim_firmware_name(size_t index) {
+    return index < FIELD_COUNT ? fields[index].name : NULL;
+}
+
+bool sim_firmware_set(const char *name, int32_t value) {
+    for (size_t i = 0; i < FIELD_COUNT; i++) {
+        if (strcmp(fields[i].name, name) == 0) {
+            *fields[i].value = value;
+            is_connect = connected != 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ble_spp_client.c
+int get_connection_quality(void) {
+    return connection_quality;
+}
+
+int32_t get_latest_erpm(void) {
+    return erpm;
+}
+
+int32_t get_latest_voltage_dv(void) {
+    return voltage_dv;
+}
+
+int32_t get_latest_current_motor_da(void) {
+    return current_motor_da;
+}
+
+int32_t get_latest_current_in_da(void) {
+    return current_in_da;
+}
+
+int32_t get_latest_amp_hours_cah(void) {
+    return amp_hours_cah;
+}
+
+// adc.c
+int32_t adc_get_battery_percent(void) {
+    return battery_percent;
+}
+
+// vesc_config.c, on the pure conversion it uses
+int32_t vesc_config_get_speed(vesc_speed_unit_t unit) {
+    static vesc_speed_factors_t factors;
+    static bool worked_out = false;
+
+    if (!worked_out) {
+        vesc_speed_factors(SIM_MOTOR_PULLEY, SIM_WHEEL_PULLEY, SIM_WHEEL_DIAMETER_MM, SIM_MOTOR_POLES, &factors);
+        worked_out = true;
+    }
+    return vesc_speed_from_erpm(erpm, factors.speed[unit]);
+}
+
+// trip.c
+int32_t trip_get_distance_hm(void) {
+    return trip_hm;
+}
+
+int32_t trip_get_energy_dwh(void) {
+    return trip_energy_dwh;
+}
+
+int32_t trip_get_efficiency_dwh_km(void) {
+    return trip_efficiency;
+}
+
+int32_t trip_get_range_hm(void) {
+    return trip_range_hm;
+}
+
+int32_t trip_get_odometer_km(void) {
+    return odometer_km;
+}
+
+// diagnostics.c, no sampler: one fixed snapshot of a remote while riding,
+// so the screen has its full layout
+static const diag_snapshot_t diag_sample = {
+    .uptime_s = 754,
+    .tasks = {
+        { "lvgl_handler", 14, 1236 },
+        { "exec_control", 3, 1604 },
+        { "btController", 6, 1872 },
+        { "BTC_TASK", 4, 1420 },
+        { "exec_background", 1, 1188 },
+        { "IDLE", 72, 652 },
+    },
+    .task_count = 6,
+    .heap_internal = 98304,
+    .heap_internal_min = 83968,
+    .heap_dma = 90112,
+    .lvgl_used = 21504,
+    .lvgl_total = 65536,
+    .fps = 24,
+    .render_ms = 9,
+    .rates = { [DIAG_ADC_SAMPLES] = 50, [DIAG_BLE_TX] = 20, [DIAG_BLE_RX] = 10 },
+    .notify_latency_ms = 38,
+    .notify_latency_max_ms = 71,
+};
+
+void diagnostics_set_visible(bool visible) {
+    (void)visible;
+}
+
+bool diagnostics_get(diag_snapshot_t *out) {
+    *out = diag_sample;
+    return true;
+}
+
+// resume.c
+ui_screen_t resume_get_screen(void) {
+    return resume_screen;
+}
+
+void resume_set_screen(ui_screen_t screen) {
+    resume_screen = screen;
+}
@@ -0,0 +1,15 @@
+#ifndef SIM_DRIVER_GPIO_H
+#define SIM_DRIVER_GPIO_H
+
+// Host stand-in for the ESP-IDF header, pin numbers only
+typedef int gpio_num_t;
+
+#define GPIO_NUM_4 4
+#define GPIO_NUM_6 6
+#define GPIO_NUM_7 7
+#define GPIO_NUM_8 8
+#define GPIO_NUM_9 9
+#define GPIO_NUM_10 10
+#define GPIO_NUM_21 21
+
+#endif // SIM_DRIVER_GPIO_H
@@ -0,0 +1,13 @@
+#ifndef SIM_ESP_CPU_H
+#define SIM_ESP_CPU_H
+
+#include <stdint.h>
+#include "sim.h"
+
+// Host stand-in for the ESP-IDF header. The benchmarks of the firmware count
+// cycles, on the host they count nanoseconds of wall clock time.
+static inline uint32_t esp_cpu_get_cycle_count(void) {
+    return (uint32_t)sim_wall_ns();
+}
+
+#endif // SIM_ESP_CPU_H
@@ -0,0 +1,18 @@
+#ifndef SIM_ESP_ERR_H
+#define SIM_ESP_ERR_H
+
+// Host stand-in for the ESP-IDF header, only what the UI sources use
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NO_MEM 0x101
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+
+static inline const char *esp_err_to_name(esp_err_t err) {
+    return err == ESP_OK ? "ESP_OK" : "ESP_FAIL";
+}
+
+#endif // SIM_ESP_ERR_H
@@ -0,0 +1,13 @@
+#ifndef SIM_ESP_HEAP_CAPS_H
+#define SIM_ESP_HEAP_CAPS_H
+
+#include <stdlib.h>
+
+// Host stand-in for the ESP-IDF header, every capability is the C heap
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DMA (1 << 3)
+
+#define heap_caps_malloc(size, caps) malloc(size)
+#define heap_caps_free(ptr) free(ptr)
+
+#endif // SIM_ESP_HEAP_CAPS_H
@@ -0,0 +1,8 @@
+#ifndef SIM_ESP_LCD_PANEL_IO_H
+#define SIM_ESP_LCD_PANEL_IO_H
+
+// Host stand-in for the ESP-IDF header, the simulator has no panel
+typedef void *esp_lcd_panel_handle_t;
+typedef void *esp_lcd_panel_io_handle_t;
+
+#endif // SIM_ESP_LCD_PANEL_IO_H
@@ -0,0 +1,6 @@
+#ifndef SIM_ESP_LCD_PANEL_VENDOR_H
+#define SIM_ESP_LCD_PANEL_VENDOR_H
+
+#include "esp_lcd_panel_io.h"
+
+#endif // SIM_ESP_LCD_PANEL_VENDOR_H
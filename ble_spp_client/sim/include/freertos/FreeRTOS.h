@@ -0,0 +1,18 @@
+#ifndef SIM_FREERTOS_H
+#define SIM_FREERTOS_H
+
+#include <stdint.h>
+
+// Host stand-in for the FreeRTOS header. Ticks run at 100 Hz like the
+// firmware and follow the simulated clock.
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+
+#define configTICK_RATE_HZ 100
+#define configMAX_TASK_NAME_LEN 16
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms) / portTICK_PERIOD_MS)
+#define pdTRUE 1
+#define pdFALSE 0
+
+#endif // SIM_FREERTOS_H
@@ -0,0 +1,9 @@
+#ifndef SIM_FREERTOS_QUEUE_H
+#define SIM_FREERTOS_QUEUE_H
+
+#include "freertos/FreeRTOS.h"
+
+// Only the handle type, for headers that declare queues
+typedef void *QueueHandle_t;
+
+#endif // SIM_FREERTOS_QUEUE_H
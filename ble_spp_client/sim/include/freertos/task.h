@@ -0,0 +1,11 @@
+#ifndef SIM_FREERTOS_TASK_H
+#define SIM_FREERTOS_TASK_H
+
+#include "freertos/FreeRTOS.h"
+#include "sim.h"
+
+static inline TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)(sim_clock_ms() / portTICK_PERIOD_MS);
+}
+
+#endif // SIM_FREERTOS_TASK_H
@@ -0,0 +1,639 @@
+// Host simulator of the BLE link to the VESC.
+//
+// Drives the connection sequence of the firmware (spp_link.c, unchanged)
+// with the GAP/GATTC events a transport model produces, and plays the SPP
+// server of the controller: it answers the client's requests, takes the
+// throttle writes and notifies telemetry, decoded with vesc_telemetry.c.
+// Time is simulated, runs are repeatable for a given seed:
+//     cmake -S sim -B build-sim && cmake --build build-sim
+//     build-sim/link_sim sim/scripts/link.txt --seed 1
+//
+// Every PDU waits for the next connection event, each lost attempt costs
+// one more connection interval (the link layer retransmits), and arrives
+// after the set latency plus up to the set jitter. Service search is
+// SEARCH_ROUND_TRIPS requests, the MTU exchange and every client
+// configuration descriptor write one each.
+//
+// Script, one command per line, # starts a comment:
+//     latency <ms> [jitter ms]  one way delay of a PDU after its connection event,
+//                               plus up to jitter (0 unless given)
+//     loss <percent>            chance that an attempt is lost
+//     interval <ms>             connection interval
+//     supervision <ms>          supervision timeout, how long a drop goes unnoticed
+//     advertise <ms>            advertising interval of the controller
+//     telemetry <ms>            notify period of the controller
+//     retained                  the remote wakes from deep sleep with the controller
+//                               and its attribute table kept, set before start
+//     stale                     the retained table no longer fits, set before start
+//     start                     boot the BLE client
+//     peer on|off               power the controller
+//     throttle <raw>            move the lever to this ADC value
+//     drop                      lose the link, both ends notice after the supervision timeout
+//     wait <ms>                 let simulated time pass
+//     mark <label>              end the current benchmark section and start a new one
+//
+// For every section: connection sequences (scan or direct open to every
+// notification enabled), throttle latency (lever moved to the value
+// reaching the controller, through ADC sampling and the send period),
+// recovery after a drop (drop to ready again) and the telemetry received.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spp_link.h"
+#include "vesc_telemetry.h"
+
+#define LINE_LEN 256
+#define QUEUE_LEN 256
+
+// As ble_spp_client.c and adc.h
+#define THROTTLE_SEND_PERIOD_MS 50
+#define ADC_SAMPLING_MS 20
+#define SCAN_INTERVAL_MS 50  // scan_interval 0x50
+#define SCAN_WINDOW_MS 30    // scan_window 0x30
+
+// Data and status notifications, SUPPORT_HEARTBEAT is off
+#define SUBSCRIPTIONS 2
+
+#define SEARCH_ROUND_TRIPS 3
+#define ADV_DELAY_MS 10        // Random delay added to every advertising event
+#define HCI_MS 1               // Host to controller and back
+#define OPEN_TIMEOUT_MS 30000  // Bluedroid gives up a connection attempt
+
+typedef enum {
+    EV_SCAN_PARAMS_SET,
+    EV_ADVERTISE,
+    EV_SCAN_STOPPED,
+    EV_OPEN_TIMEOUT,
+    EV_CONNECTED,
+    EV_SEARCH_STEP,     // arg: round trips left
+    EV_MTU_DONE,
+    EV_CCCD_AT_PEER,    // arg: subscription
+    EV_CCCD_WRITTEN,
+    EV_DISCONNECTED,
+    EV_ADC_SAMPLE,
+    EV_THROTTLE_SEND,
+    EV_THROTTLE_AT_PEER, // arg: raw value
+    EV_TELEMETRY,
+    EV_NOTIFY,           // arg: erpm of the payload
+} event_type_t;
+
+typedef struct {
+    uint32_t at_ms;
+    uint32_t seq;        // Same time, first scheduled first
+    event_type_t type;
+    uint32_t conn;       // Connection it belongs to, 0 for none
+    int32_t arg;
+} event_t;
+
+typedef struct {
+    char label[64];
+    uint32_t *latency_ms;
+    size_t latencies;
+    size_t capacity;
+    size_t superseded;   // Moved again before the value arrived
+    uint32_t connects;
+    uint64_t connect_ms;
+    uint32_t connect_max_ms;
+    uint32_t recoveries;
+    uint64_t recovery_ms;
+    uint32_t recovery_max_ms;
+    uint32_t throttle_writes;
+    uint32_t notifies;
+    uint32_t bad_notifies;
+    uint32_t retransmits;
+    uint32_t closes;
+} section_t;
+
+static event_t queue[QUEUE_LEN];
+static size_t queued;
+static uint32_t next_seq;
+static uint32_t clock_ms;
+static uint64_t rng = 0x9E3779B97F4A7C15ull;
+static section_t section;
+
+// Transport
+static uint32_t latency_ms = 2;
+static uint32_t jitter_ms = 1;
+static uint32_t loss_percent;
+static uint32_t interval_ms = 30;
+static uint32_t supervision_ms = 2000;
+static uint32_t advertise_ms = 100;
+static uint32_t telemetry_ms = 100;
+static uint32_t conn;         // Current connection, 0 when there is none
+static uint32_t conn_count;
+static uint32_t anchor_ms;    // First connection event
+static uint32_t last_up_ms;   // In order delivery, per direction
+static uint32_t last_down_ms;
+static bool radio_up;         // Cleared by a drop until the supervision timeout
+
+// Client
+static spp_link_t connection;
+static bool started;
+static bool retained;
+static bool retained_stale;
+static bool have_db;          // Attribute table loaded, throttle goes out
+static uint32_t open_attempt;
+static uint32_t sequence_start_ms;
+static bool drop_pending;
+static uint32_t drop_ms;
+static int32_t lever = 2048;  // Throttle position, neutral
+static int32_t sampled = 2048; // Latest ADC value
+static uint32_t moved_ms;
+static bool move_pending;
+
+// Controller
+static bool peer_on = true;
+static bool advertising;      // Next advertising event scheduled
+static bool peer_connected;
+static bool peer_notify;      // Data notifications enabled by the client
+static int32_t peer_throttle = 2048;
+
+static void run_link(spp_link_action_t action);
+
+static uint32_t random_below(uint32_t n) {
+    // xorshift64
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return n ? (uint32_t)(rng % n) : 0;
+}
+
+static void schedule(uint32_t at_ms, event_type_t type, uint32_t on_conn, int32_t arg) {
+    if (queued == QUEUE_LEN) {
+        fprintf(stderr, "Event queue full\n");
+        exit(2);
+    }
+    event_t ev = { at_ms, next_seq++, type, on_conn, arg };
+    size_t i = queued++;
+    while (i > 0 && (queue[i - 1].at_ms > at_ms ||
+                     (queue[i - 1].at_ms == at_ms && queue[i - 1].seq > ev.seq))) {
+        queue[i] = queue[i - 1];
+        i--;
+    }
+    queue[i] = ev;
+}
+
+// When a PDU queued at `from` reaches the other end, false if the link is down
+static bool deliver_at(uint32_t from, uint32_t *last_ms, uint32_t *at_ms) {
+    if (conn == 0 || !radio_up) {
+        return false;
+    }
+    uint32_t since = from > anchor_ms ? from - anchor_ms : 0;
+    uint32_t t = anchor_ms + (since + interval_ms - 1) / interval_ms * interval_ms;
+    while (random_below(100) < loss_percent) {
+        t += interval_ms;
+        section.retransmits++;
+    }
+    t += latency_ms + random_below(jitter_ms + 1);
+    if (t < *last_ms) {
+        t = *last_ms;
+    }
+    *last_ms = t;
+    *at_ms = t;
+    return true;
+}
+
+static void send_up(event_type_t type, int32_t arg) {
+    uint32_t at;
+    if (deliver_at(clock_ms, &last_up_ms, &at)) {
+        schedule(at, type, conn, arg);
+    }
+}
+
+static void send_down(event_type_t type, int32_t arg) {
+    uint32_t at;
+    if (deliver_at(clock_ms, &last_down_ms, &at)) {
+        schedule(at, type, conn, arg);
+    }
+}
+
+// A request answered by the controller
+static void round_trip(event_type_t type, int32_t arg) {
+    uint32_t up;
+    uint32_t down;
+    if (deliver_at(clock_ms, &last_up_ms, &up) && deliver_at(up, &last_down_ms, &down)) {
+        schedule(down, type, conn, arg);
+    }
+}
+
+static void schedule_advertising(void) {
+    if (advertising) {
+        return;
+    }
+    advertising = true;
+    schedule(clock_ms + advertise_ms + random_below(ADV_DELAY_MS + 1), EV_ADVERTISE, 0, 0);
+}
+
+static void connection_lost(void) {
+    conn = 0;
+    have_db = false;
+    peer_connected = false;
+    peer_notify = false;
+}
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static void section_add_latency(uint32_t ms) {
+    if (section.latencies == section.capacity) {
+        section.capacity = section.capacity ? section.capacity * 2 : 256;
+        section.latency_ms = realloc(section.latency_ms, section.capacity * sizeof(uint32_t));
+        if (section.latency_ms == NULL) {
+            fprintf(stderr, "Out of memory\n");
+            exit(2);
+        }
+    }
+    section.latency_ms[section.latencies++] = ms;
+}
+
+static void section_print(void) {
+    printf("%-16s", section.label);
+    if (section.connects) {
+        printf("  connect ms avg %lu max %lu (%lu)", (unsigned long)(section.connect_ms / section.connects),
+               (unsigned long)section.connect_max_ms, (unsigned long)section.connects);
+    }
+    if (section.recoveries) {
+        printf("  recovery ms avg %lu max %lu (%lu)", (unsigned long)(section.recovery_ms / section.recoveries),
+               (unsigned long)section.recovery_max_ms, (unsigned long)section.recoveries);
+    }
+    if (section.latencies) {
+        uint64_t total = 0;
+        for (size_t i = 0; i < section.latencies; i++) {
+            total += section.latency_ms[i];
+        }
+        qsort(section.latency_ms, section.latencies, sizeof(uint32_t), compare_u32);
+        printf("  throttle ms avg %lu p50 %lu p95 %lu max %lu (%zu, %zu superseded)",
+               (unsigned long)(total / section.latencies),
+               (unsigned long)section.latency_ms[section.latencies / 2],
+               (unsigned long)section.latency_ms[section.latencies * 95 / 100],
+               (unsigned long)section.latency_ms[section.latencies - 1], section.latencies, section.superseded);
+    }
+    printf("  writes %lu  notifies %lu", (unsigned long)section.throttle_writes, (unsigned long)section.notifies);
+    if (section.bad_notifies) {
+        printf(" (%lu bad)", (unsigned long)section.bad_notifies);
+    }
+    printf("  retransmits %lu", (unsigned long)section.retransmits);
+    if (section.closes) {
+        printf("  closes %lu", (unsigned long)section.closes);
+    }
+    printf("\n");
+}
+
+static void section_start(const char *label) {
+    uint32_t *latency_ms = section.latency_ms;
+    size_t capacity = section.capacity;
+
+    memset(&section, 0, sizeof(section));
+    section.latency_ms = latency_ms;
+    section.capacity = capacity;
+    snprintf(section.label, sizeof(section.label), "%.63s", label);
+}
+
+// Telemetry of the controller, voltage and currents follow the throttle
+static void encode_telemetry(int32_t erpm, uint8_t *data) {
+    int32_t effort = peer_throttle > 2048 ? peer_throttle - 2048 : 0;
+    int16_t values[] = {
+        (int16_t)(4020 - effort / 8),  // voltage cV, sagging
+        0,                             // eRPM, below
+        (int16_t)(effort * 2),         // motor current cA
+        (int16_t)effort,               // input current cA
+        120,                           // amp hours cAh
+        3,                             // amp hours charged cAh
+    };
+
+    data[0] = (uint8_t)(values[0] >> 8);
+    data[1] = (uint8_t)values[0];
+    data[2] = (uint8_t)(erpm >> 24);
+    data[3] = (uint8_t)(erpm >> 16);
+    data[4] = (uint8_t)(erpm >> 8);
+    data[5] = (uint8_t)erpm;
+    for (size_t i = 2; i < sizeof(values) / sizeof(values[0]); i++) {
+        data[2 * i + 2] = (uint8_t)(values[i] >> 8);
+        data[2 * i + 3] = (uint8_t)values[i];
+    }
+}
+
+static void ready_check(void) {
+    if (!spp_link_is_ready(&connection) || sequence_start_ms == UINT32_MAX) {
+        return;
+    }
+    uint32_t took = clock_ms - sequence_start_ms;
+    section.connects++;
+    section.connect_ms += took;
+    if (took > section.connect_max_ms) {
+        section.connect_max_ms = took;
+    }
+    sequence_start_ms = UINT32_MAX;
+
+    if (drop_pending) {
+        took = clock_ms - drop_ms;
+        section.recoveries++;
+        section.recovery_ms += took;
+        if (took > section.recovery_max_ms) {
+            section.recovery_max_ms = took;
+        }
+        drop_pending = false;
+    }
+}
+
+static void open_connection(void) {
+    open_attempt++;
+    schedule(clock_ms + OPEN_TIMEOUT_MS, EV_OPEN_TIMEOUT, 0, (int32_t)open_attempt);
+}
+
+// What ble_spp_client.c does for each action, against the model
+static void run_link(spp_link_action_t action) {
+    switch (action) {
+    case SPP_LINK_ACT_NONE:
+        break;
+    case SPP_LINK_ACT_FORGET_PEER:
+        // Scanning takes over
+        retained = false;
+        // Fall through
+    case SPP_LINK_ACT_START_SCAN:
+        if (sequence_start_ms == UINT32_MAX) {
+            sequence_start_ms = clock_ms;
+        }
+        break;
+    case SPP_LINK_ACT_STOP_SCAN:
+        schedule(clock_ms + HCI_MS, EV_SCAN_STOPPED, 0, 0);
+        break;
+    case SPP_LINK_ACT_OPEN_PEER:
+        sequence_start_ms = clock_ms;
+        open_connection();
+        break;
+    case SPP_LINK_ACT_OPEN_FOUND:
+        open_connection();
+        break;
+    case SPP_LINK_ACT_RESTORE_ATTRS:
+        have_db = !retained_stale;
+        run_link(spp_link_attrs(&connection, have_db));
+        break;
+    case SPP_LINK_ACT_SEARCH:
+        round_trip(EV_SEARCH_STEP, SEARCH_ROUND_TRIPS - 1);
+        break;
+    case SPP_LINK_ACT_REQUEST_MTU:
+        round_trip(EV_MTU_DONE, 0);
+        break;
+    case SPP_LINK_ACT_LOAD_ATTRS:
+        have_db = true;
+        run_link(spp_link_attrs(&connection, true));
+        break;
+    case SPP_LINK_ACT_REGISTER_NOTIFY:
+        // Local to Bluedroid, no PDU
+        run_link(spp_link_notify_registered(&connection, true));
+        break;
+    case SPP_LINK_ACT_WRITE_CCCD:
+        send_up(EV_CCCD_AT_PEER, (int32_t)connection.step);
+        break;
+    case SPP_LINK_ACT_CLOSE:
+        section.closes++;
+        schedule(clock_ms + interval_ms, EV_DISCONNECTED, conn, 0);
+        break;
+    }
+    ready_check();
+}
+
+static void dispatch(const event_t *ev) {
+    uint8_t payload[VESC_TELEMETRY_LEN];
+    vesc_telemetry_t telemetry;
+
+    // Whatever was in flight dies with its connection
+    if (ev->conn != 0 && ev->conn != conn) {
+        return;
+    }
+
+    switch (ev->type) {
+    case EV_SCAN_PARAMS_SET:
+        run_link(spp_link_scan_params_set(&connection));
+        break;
+    case EV_ADVERTISE:
+        advertising = false;
+        if (!peer_on || peer_connected) {
+            break;
+        }
+        if (connection.state == SPP_LINK_OPENING) {
+            // The initiator listens all the time, it answers with a connection request
+            conn = ++conn_count;
+            anchor_ms = clock_ms + HCI_MS + interval_ms;
+            last_up_ms = anchor_ms;
+            last_down_ms = anchor_ms;
+            radio_up = true;
+            peer_connected = true;
+            schedule(anchor_ms, EV_CONNECTED, conn, 0);
+            break;
+        }
+        if (connection.state == SPP_LINK_SCANNING && clock_ms % SCAN_INTERVAL_MS < SCAN_WINDOW_MS) {
+            run_link(spp_link_found(&connection));
+        }
+        schedule_advertising();
+        break;
+    case EV_SCAN_STOPPED:
+        run_link(spp_link_scan_stopped(&connection));
+        break;
+    case EV_OPEN_TIMEOUT:
+        if ((uint32_t)ev->arg == open_attempt && connection.state == SPP_LINK_OPENING && conn == 0) {
+            run_link(spp_link_open_failed(&connection));
+        }
+        break;
+    case EV_CONNECTED:
+        open_attempt++;
+        run_link(spp_link_connected(&connection));
+        break;
+    case EV_SEARCH_STEP:
+        if (ev->arg > 0) {
+            round_trip(EV_SEARCH_STEP, ev->arg - 1);
+        } else {
+            run_link(spp_link_search_done(&connection));
+        }
+        break;
+    case EV_MTU_DONE:
+        run_link(spp_link_mtu_done(&connection));
+        break;
+    case EV_CCCD_AT_PEER:
+        if (ev->arg == 0) {
+            peer_notify = true;
+        }
+        send_down(EV_CCCD_WRITTEN, 0);
+        break;
+    case EV_CCCD_WRITTEN:
+        run_link(spp_link_cccd_written(&connection, true));
+        break;
+    case EV_DISCONNECTED:
+        connection_lost();
+        run_link(spp_link_disconnected(&connection));
+        if (peer_on) {
+            schedule_advertising();
+        }
+        break;
+    case EV_ADC_SAMPLE:
+        sampled = lever;
+        schedule(clock_ms + ADC_SAMPLING_MS, EV_ADC_SAMPLE, 0, 0);
+        break;
+    case EV_THROTTLE_SEND:
+        if (conn != 0 && have_db) {
+            // throttle_send() samples before it writes
+            sampled = lever;
+            section.throttle_writes++;
+            send_up(EV_THROTTLE_AT_PEER, sampled);
+        }
+        schedule(clock_ms + THROTTLE_SEND_PERIOD_MS, EV_THROTTLE_SEND, 0, 0);
+        break;
+    case EV_THROTTLE_AT_PEER:
+        peer_throttle = ev->arg;
+        if (move_pending && ev->arg == lever) {
+            section_add_latency(clock_ms - moved_ms);
+            move_pending = false;
+        }
+        break;
+    case EV_TELEMETRY:
+        if (peer_connected && peer_notify) {
+            send_down(EV_NOTIFY, (peer_throttle - 2048) * 12);
+        }
+        schedule(clock_ms + telemetry_ms, EV_TELEMETRY, 0, 0);
+        break;
+    case EV_NOTIFY:
+        encode_telemetry(ev->arg, payload);
+        if (vesc_telemetry_decode(payload, sizeof(payload), &telemetry) && telemetry.erpm == ev->arg) {
+            section.notifies++;
+        } else {
+            section.bad_notifies++;
+        }
+        break;
+    }
+}
+
+static void run_for(uint32_t ms) {
+    uint32_t until = clock_ms + ms;
+
+    while (queued > 0 && queue[0].at_ms <= until) {
+        event_t ev = queue[0];
+        queued--;
+        memmove(queue, queue + 1, queued * sizeof(event_t));
+        clock_ms = ev.at_ms;
+        dispatch(&ev);
+    }
+    clock_ms = until;
+}
+
+static bool run_line(const char *line) {
+    char cmd[32];
+    char arg[LINE_LEN];
+    long value;
+    long extra;
+
+    if (sscanf(line, "%31s", cmd) != 1 || cmd[0] == '#') {
+        return true;
+    }
+
+    int args = sscanf(line, "%*s %ld %ld", &value, &extra);
+    if (strcmp(cmd, "wait") == 0 && args >= 1 && value >= 0) {
+        run_for((uint32_t)value);
+    } else if (strcmp(cmd, "latency") == 0 && args >= 1 && value >= 0) {
+        latency_ms = (uint32_t)value;
+        jitter_ms = args == 2 && extra >= 0 ? (uint32_t)extra : 0;
+    } else if (strcmp(cmd, "loss") == 0 && args == 1 && value >= 0 && value < 100) {
+        loss_percent = (uint32_t)value;
+    } else if (strcmp(cmd, "interval") == 0 && args == 1 && value > 0) {
+        interval_ms = (uint32_t)value;
+    } else if (strcmp(cmd, "supervision") == 0 && args == 1 && value > 0) {
+        supervision_ms = (uint32_t)value;
+    } else if (strcmp(cmd, "advertise") == 0 && args == 1 && value > 0) {
+        advertise_ms = (uint32_t)value;
+    } else if (strcmp(cmd, "telemetry") == 0 && args == 1 && value > 0) {
+        telemetry_ms = (uint32_t)value;
+    } else if (strcmp(cmd, "retained") == 0 && !started) {
+        retained = true;
+    } else if (strcmp(cmd, "stale") == 0 && !started) {
+        retained_stale = true;
+    } else if (strcmp(cmd, "start") == 0 && !started) {
+        started = true;
+        spp_link_init(&connection, SUBSCRIPTIONS, retained);
+        schedule(clock_ms + HCI_MS, EV_SCAN_PARAMS_SET, 0, 0);
+        schedule(clock_ms, EV_ADC_SAMPLE, 0, 0);
+        schedule(clock_ms, EV_THROTTLE_SEND, 0, 0);
+    } else if (strcmp(cmd, "peer") == 0 && sscanf(line, "%*s %255s", arg) == 1 &&
+               (strcmp(arg, "on") == 0 || strcmp(arg, "off") == 0)) {
+        bool on = arg[1] == 'n';
+        if (on && !peer_on) {
+            schedule_advertising();
+        } else if (!on && peer_on && conn != 0) {
+            // The client notices after the supervision timeout
+            radio_up = false;
+            schedule(clock_ms + supervision_ms, EV_DISCONNECTED, conn, 0);
+        }
+        peer_on = on;
+    } else if (strcmp(cmd, "throttle") == 0 && args == 1 && value >= 0 && value <= 4095) {
+        if (move_pending) {
+            section.superseded++;
+        }
+        lever = (int32_t)value;
+        moved_ms = clock_ms;
+        move_pending = true;
+    } else if (strcmp(cmd, "drop") == 0) {
+        if (conn != 0 && radio_up) {
+            radio_up = false;
+            drop_pending = true;
+            drop_ms = clock_ms;
+            schedule(clock_ms + supervision_ms, EV_DISCONNECTED, conn, 0);
+        }
+    } else if (strcmp(cmd, "mark") == 0 && sscanf(line, "%*s %63s", arg) == 1) {
+        section_print();
+        section_start(arg);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    const char *script_path = NULL;
+    char line[LINE_LEN];
+    int line_no = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            // xorshift must not start from 0
+            rng ^= strtoull(argv[++i], NULL, 0) * 0x2545F4914F6CDD1Dull;
+            if (rng == 0) {
+                rng = 1;
+            }
+        } else if (script_path == NULL && argv[i][0] != '-') {
+            script_path = argv[i];
+        } else {
+            script_path = NULL;
+            break;
+        }
+    }
+    if (script_path == NULL) {
+        fprintf(stderr, "usage: %s <script> [--seed <n>]\n", argv[0]);
+        return 2;
+    }
+    FILE *script = fopen(script_path, "r");
+    if (script == NULL) {
+        perror(script_path);
+        return 2;
+    }
+
+    sequence_start_ms = UINT32_MAX;
+    section_start("boot");
+    schedule_advertising();
+    schedule(clock_ms, EV_TELEMETRY, 0, 0);
+
+    while (fgets(line, sizeof(line), script) != NULL) {
+        line_no++;
+        if (!run_line(line)) {
+            fprintf(stderr, "%s:%d: cannot run: %s", script_path, line_no, line);
+            return 2;
+        }
+    }
+    fclose(script);
+    section_print();
+    return 0;
+}
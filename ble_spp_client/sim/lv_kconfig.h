@@ -0,0 +1,12 @@
+#ifndef SIM_LV_KCONFIG_H
+#define SIM_LV_KCONFIG_H
+
+// LVGL configuration of the simulator: the CONFIG_LV_ options of the
+// project sdkconfig, extracted by CMakeLists.txt, so the host renders with
+// the same settings as the firmware. Only the tick source differs.
+#include "sdkconfig.h"
+
+#define LV_TICK_CUSTOM_INCLUDE "sim.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (sim_clock_ms())
+
+#endif // SIM_LV_KCONFIG_H
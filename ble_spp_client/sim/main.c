@@ -0,0 +1,426 @@
+// Host simulator of the remote's display.
+//
+// Renders the firmware UI on the vendored LVGL into a 240x320 RGB565
+// framebuffer, with no SDL or panel, and replays a script of telemetry and
+// button events. Build and run from the project directory:
+//     cmake -S sim -B build-sim && cmake --build build-sim
+//     build-sim/ui_sim sim/scripts/ride.txt --frames frames.csv
+//
+// sim/scripts/golden.txt compares every screen with the frames in
+// sim/golden/, ctest runs it. After an intended change of the UI, look at
+// the .actual.png files and take them over with --update.
+//
+// Script, one command per line, # starts a comment:
+//     wait <ms>               let simulated time pass, rendering as the LVGL task would
+//     set <name> <value>      change a firmware value, then refresh the bindings as a
+//                             telemetry notify does. Names and units are in firmware.c.
+//     screen <name>           splash, home, detailed, shutdown or diagnostics
+//     press / release         button edges, recognised by button_gesture like the firmware
+//     snap <file.png>         write the display
+//     expect <file.png>       compare the display with a golden snapshot, byte for byte.
+//                             A mismatch is written next to it as <file.png>.actual.png
+//                             and makes the run exit with 1. With --update the
+//                             display is written to <file.png> instead.
+//     mark <label>            end the current benchmark section and start a new one
+//
+// For every section the frame count, render time, invalidated area and
+// flushes are printed. --frames writes one CSV line per frame. Render times
+// are host wall clock, useful to compare two builds on the same machine,
+// not as ESP32 figures; area and flushes are exact.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl.h"
+#include "sim.h"
+#include "button_actions.h"
+#include "screen_manager.h"
+#include "ui_updater.h"
+#include "status_bar.h"
+
+#define LINE_LEN 256
+
+// Same as sleep_start_shutdown_animation()
+#define SHUTDOWN_FILL_MS 2000
+
+typedef struct {
+    char label[64];
+    uint32_t *render_us;
+    size_t frames;
+    size_t capacity;
+    uint64_t area_px;
+    uint64_t flushes;
+    uint64_t flushed_px;
+} section_t;
+
+static const struct {
+    const char *name;
+    ui_screen_t screen;
+} screen_names[] = {
+    { "splash", UI_SCREEN_SPLASH },
+    { "home", UI_SCREEN_HOME },
+    { "detailed", UI_SCREEN_DETAILED },
+    { "shutdown", UI_SCREEN_SHUTDOWN },
+    { "diagnostics", UI_SCREEN_DIAGNOSTICS },
+};
+
+#define SCREEN_NAME_COUNT (sizeof(screen_names) / sizeof(screen_names[0]))
+
+static uint32_t clock_ms;
+static FILE *frames_csv;
+static section_t section;
+static bool refresh_pending;
+static bool riding;              // Panel off, LVGL does not render
+static button_actions_t actions;
+static bool shutdown_running;
+static lv_anim_t shutdown_anim;
+static button_gesture_t gestures[BUTTON_ACTIONS_GESTURE_COUNT];
+static button_gesture_state_t gesture_state;
+static int failures;
+static bool update_golden;
+
+uint32_t sim_clock_ms(void) {
+    return clock_ms;
+}
+
+uint64_t sim_wall_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static void section_add(const sim_frame_t *frame) {
+    if (section.frames == section.capacity) {
+        section.capacity = section.capacity ? section.capacity * 2 : 256;
+        section.render_us = realloc(section.render_us, section.capacity * sizeof(uint32_t));
+        if (section.render_us == NULL) {
+            fprintf(stderr, "Out of memory\n");
+            exit(2);
+        }
+    }
+    section.render_us[section.frames++] = frame->render_us;
+    section.area_px += frame->area_px;
+    section.flushes += frame->flushes;
+    section.flushed_px += frame->flushed_px;
+
+    if (frames_csv != NULL) {
+        fprintf(frames_csv, "%s,%lu,%lu,%lu,%lu,%lu\n", section.label, (unsigned long)frame->at_ms,
+                (unsigned long)frame->render_us, (unsigned long)frame->area_px, (unsigned long)frame->flushes,
+                (unsigned long)frame->flushed_px);
+    }
+}
+
+static void section_print(void) {
+    uint64_t total_us = 0;
+
+    if (section.frames == 0) {
+        printf("%-16s no frames\n", section.label);
+        return;
+    }
+    for (size_t i = 0; i < section.frames; i++) {
+        total_us += section.render_us[i];
+    }
+    qsort(section.render_us, section.frames, sizeof(uint32_t), compare_u32);
+    printf("%-16s %5zu frames  render us avg %lu p50 %lu p95 %lu max %lu  area px/frame %lu  "
+           "flushes %lu  flushed px %lu (%lu screens)\n",
+           section.label, section.frames, (unsigned long)(total_us / section.frames),
+           (unsigned long)section.render_us[section.frames / 2],
+           (unsigned long)section.render_us[section.frames * 95 / 100],
+           (unsigned long)section.render_us[section.frames - 1],
+           (unsigned long)(section.area_px / section.frames), (unsigned long)section.flushes,
+           (unsigned long)section.flushed_px,
+           (unsigned long)(section.flushed_px / (SIM_HOR_RES * SIM_VER_RES)));
+}
+
+static void section_start(const char *label) {
+    section.frames = 0;
+    section.area_px = 0;
+    section.flushes = 0;
+    section.flushed_px = 0;
+    snprintf(section.label, sizeof(section.label), "%.63s", label);
+}
+
+// As ui_cmd_process() does for UI_CMD_LOAD_SCREEN
+static void load_screen(ui_screen_t screen) {
+    screen_manager_load(screen);
+    refresh_pending = true;
+}
+
+static void set_bar_value(void *bar, int32_t value) {
+    lv_bar_set_value(bar, value, LV_ANIM_OFF);
+}
+
+// default_button_handler() of button.c and the shutdown part of sleep.c,
+// minus sleeping
+static void emit_event(button_event_t event, void *ctx) {
+    (void)ctx;
+
+    switch (event) {
+        case BUTTON_EVENT_RELEASED:
+            if (shutdown_running) {
+                lv_anim_del(ui_Bar4, set_bar_value);
+                lv_bar_set_value(ui_Bar4, 0, LV_ANIM_OFF);
+                shutdown_running = false;
+                load_screen(UI_SCREEN_HOME);
+            }
+            break;
+        case BUTTON_EVENT_LONG_PRESS:
+            riding = false;
+            load_screen(UI_SCREEN_SHUTDOWN);
+            lv_anim_init(&shutdown_anim);
+            lv_anim_set_var(&shutdown_anim, ui_Bar4);
+            lv_anim_set_exec_cb(&shutdown_anim, set_bar_value);
+            lv_anim_set_time(&shutdown_anim, SHUTDOWN_FILL_MS);
+            lv_anim_set_values(&shutdown_anim, 0, 100);
+            lv_anim_start(&shutdown_anim);
+            shutdown_running = true;
+            break;
+        default: {
+            button_action_t action = button_actions_handle(&actions, event, riding);
+            if (action.riding != BUTTON_RIDING_KEEP) {
+                riding = action.riding == BUTTON_RIDING_ENTER;
+            }
+            if (action.load) {
+                load_screen(action.screen);
+            }
+            break;
+        }
+    }
+}
+
+// One pass of lvgl_handler_task() in lcd.c. Returns the time until LVGL
+// needs the next pass.
+static uint32_t lvgl_pass(void) {
+    sim_frame_t frame;
+    uint32_t next_ms = LV_NO_TIMER_READY;
+
+    if (refresh_pending) {
+        refresh_pending = false;
+        ui_updater_refresh();
+        status_bar_refresh();
+    }
+    if (riding) {
+        return next_ms;
+    }
+
+    sim_display_begin();
+    uint64_t start = sim_wall_ns();
+    next_ms = lv_timer_handler();
+    uint64_t elapsed = sim_wall_ns() - start;
+    if (sim_display_end(&frame)) {
+        frame.render_us = (uint32_t)(elapsed / 1000);
+        section_add(&frame);
+    }
+    return next_ms;
+}
+
+static void run_for(uint32_t ms) {
+    uint32_t end = clock_ms + ms;
+
+    for (;;) {
+        uint32_t next_ms = lvgl_pass();
+        if (clock_ms >= end) {
+            break;
+        }
+        uint32_t gesture_ms = button_gesture_next_ms(&gesture_state, clock_ms);
+        if (gesture_ms < next_ms) {
+            next_ms = gesture_ms;
+        }
+        if (next_ms == 0) {
+            next_ms = 1;
+        }
+        if (next_ms > end - clock_ms) {
+            next_ms = end - clock_ms;
+        }
+        clock_ms += next_ms;
+        button_gesture_tick(&gesture_state, clock_ms, emit_event, NULL);
+    }
+}
+
+static bool encode_display(uint8_t **png, size_t *len) {
+    static const uint16_t dark[SIM_HOR_RES * SIM_VER_RES];
+
+    // Riding mode keeps the panel off
+    return png_encode_rgb565(riding ? dark : sim_display_framebuffer(), SIM_HOR_RES, SIM_VER_RES,
+                             LV_COLOR_16_SWAP, png, len);
+}
+
+static bool write_file(const char *path, const uint8_t *data, size_t len) {
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return false;
+    }
+    bool ok = fwrite(data, 1, len, f) == len;
+    return fclose(f) == 0 && ok;
+}
+
+static bool snap(const char *path) {
+    uint8_t *png;
+    size_t len;
+
+    if (!encode_display(&png, &len)) {
+        return false;
+    }
+    bool ok = write_file(path, png, len);
+    free(png);
+    return ok;
+}
+
+static bool expect(const char *path) {
+    uint8_t *png;
+    size_t len;
+    char actual[LINE_LEN + 16];
+    bool match = false;
+
+    if (update_golden) {
+        return snap(path);
+    }
+    if (!encode_display(&png, &len)) {
+        return false;
+    }
+
+    FILE *f = fopen(path, "rb");
+    if (f != NULL) {
+        uint8_t *golden = malloc(len + 1);
+        match = golden != NULL && fread(golden, 1, len + 1, f) == len && memcmp(golden, png, len) == 0;
+        free(golden);
+        fclose(f);
+    }
+
+    if (!match) {
+        snprintf(actual, sizeof(actual), "%s.actual.png", path);
+        write_file(actual, png, len);
+        fprintf(stderr, "%s: display differs, see %s\n", path, actual);
+        failures++;
+    }
+    free(png);
+    return true;
+}
+
+static bool find_screen(const char *name, ui_screen_t *screen) {
+    for (size_t i = 0; i < SCREEN_NAME_COUNT; i++) {
+        if (strcmp(screen_names[i].name, name) == 0) {
+            *screen = screen_names[i].screen;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void print_names(void) {
+    fprintf(stderr, "Names:");
+    for (size_t i = 0; sim_firmware_name(i) != NULL; i++) {
+        fprintf(stderr, " %s", sim_firmware_name(i));
+    }
+    fprintf(stderr, "\n");
+}
+
+static bool run_line(const char *line) {
+    char cmd[32];
+    char arg[LINE_LEN];
+    long value;
+    ui_screen_t screen;
+
+    if (sscanf(line, "%31s", cmd) != 1 || cmd[0] == '#') {
+        return true;
+    }
+
+    if (strcmp(cmd, "wait") == 0 && sscanf(line, "%*s %ld", &value) == 1 && value >= 0) {
+        run_for((uint32_t)value);
+    } else if (strcmp(cmd, "set") == 0 && sscanf(line, "%*s %255s %ld", arg, &value) == 2) {
+        if (!sim_firmware_set(arg, (int32_t)value)) {
+            print_names();
+            return false;
+        }
+        refresh_pending = true;
+    } else if (strcmp(cmd, "screen") == 0 && sscanf(line, "%*s %255s", arg) == 1) {
+        if (!find_screen(arg, &screen)) {
+            return false;
+        }
+        riding = false;
+        load_screen(screen);
+    } else if (strcmp(cmd, "press") == 0 || strcmp(cmd, "release") == 0) {
+        button_gesture_edge(&gesture_state, cmd[0] == 'p', clock_ms, emit_event, NULL);
+    } else if (strcmp(cmd, "snap") == 0 && sscanf(line, "%*s %255s", arg) == 1) {
+        run_for(0);
+        return snap(arg);
+    } else if (strcmp(cmd, "expect") == 0 && sscanf(line, "%*s %255s", arg) == 1) {
+        run_for(0);
+        return expect(arg);
+    } else if (strcmp(cmd, "mark") == 0 && sscanf(line, "%*s %63s", arg) == 1) {
+        section_print();
+        section_start(arg);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    const char *script_path = NULL;
+    char line[LINE_LEN];
+    int line_no = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames_csv = fopen(argv[++i], "w");
+            if (frames_csv == NULL) {
+                perror(argv[i]);
+                return 2;
+            }
+            fprintf(frames_csv, "section,t_ms,render_us,area_px,flushes,flushed_px\n");
+        } else if (strcmp(argv[i], "--update") == 0) {
+            update_golden = true;
+        } else if (script_path == NULL && argv[i][0] != '-') {
+            script_path = argv[i];
+        } else {
+            script_path = NULL;
+            break;
+        }
+    }
+    if (script_path == NULL) {
+        fprintf(stderr, "usage: %s <script> [--frames <file.csv>] [--update]\n", argv[0]);
+        return 2;
+    }
+    FILE *script = fopen(script_path, "r");
+    if (script == NULL) {
+        perror(script_path);
+        return 2;
+    }
+
+    lv_init();
+    sim_display_init();
+
+    // Same as button_init(), from a cold boot
+    button_actions_init(&actions, UI_SCREEN_HOME);
+    button_actions_gestures(gestures, BUTTON_LONG_PRESS_TIME_MS);
+    button_gesture_init(&gesture_state, gestures, BUTTON_ACTIONS_GESTURE_COUNT, BUTTON_DOUBLE_PRESS_TIME_MS);
+
+    // Cold boot of main.c
+    screen_manager_init();
+    ui_updater_init();
+    section_start("boot");
+    screen_manager_load(UI_SCREEN_SPLASH);
+
+    while (fgets(line, sizeof(line), script) != NULL) {
+        line_no++;
+        if (!run_line(line)) {
+            fprintf(stderr, "%s:%d: cannot run: %s", script_path, line_no, line);
+            return 2;
+        }
+    }
+    fclose(script);
+    section_print();
+
+    if (frames_csv != NULL) {
+        fclose(frames_csv);
+    }
+    return failures ? 1 : 0;
+}
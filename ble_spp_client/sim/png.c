@@ -0,0 +1,246 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+// One deflate block with the fixed Huffman codes, matching only the pixel
+// to the left and the one above: no zlib needed, the output of a
+// framebuffer is always the same bytes, and the flat colours of the UI
+// come to a few kB, small enough to keep golden frames in the tree.
+
+#define MATCH_MIN 3
+#define MATCH_MAX 258
+#define END_OF_BLOCK 256
+
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+} writer_t;
+
+// Deflate packs its bits from the least significant end
+typedef struct {
+    writer_t *w;
+    uint32_t bits;
+    int count;
+} bit_writer_t;
+
+static const uint16_t length_base[] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+static const uint8_t length_extra[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+};
+static const uint16_t distance_base[] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073,
+    4097, 6145, 8193, 12289, 16385, 24577,
+};
+static const uint8_t distance_extra[] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13,
+};
+
+static uint32_t crc_table[256];
+
+static void crc_init(void) {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        crc_table[n] = c;
+    }
+}
+
+static uint32_t crc32(const uint8_t *data, size_t len) {
+    uint32_t c = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        c = crc_table[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+    }
+    return c ^ 0xFFFFFFFFu;
+}
+
+static uint32_t adler32(const uint8_t *data, size_t len) {
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (size_t i = 0; i < len; i++) {
+        a = (a + data[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return (b << 16) | a;
+}
+
+static void put_u32(writer_t *w, uint32_t v) {
+    w->buf[w->len++] = v >> 24;
+    w->buf[w->len++] = v >> 16;
+    w->buf[w->len++] = v >> 8;
+    w->buf[w->len++] = v;
+}
+
+static void put_bytes(writer_t *w, const void *data, size_t len) {
+    if (len == 0) {
+        return;
+    }
+    memcpy(w->buf + w->len, data, len);
+    w->len += len;
+}
+
+static void put_bits(bit_writer_t *b, uint32_t value, int count) {
+    b->bits |= value << b->count;
+    b->count += count;
+    while (b->count >= 8) {
+        b->w->buf[b->w->len++] = (uint8_t)b->bits;
+        b->bits >>= 8;
+        b->count -= 8;
+    }
+}
+
+// Huffman codes go most significant bit first
+static void put_code(bit_writer_t *b, uint32_t code, int count) {
+    uint32_t reversed = 0;
+    for (int i = 0; i < count; i++) {
+        reversed = (reversed << 1) | ((code >> i) & 1);
+    }
+    put_bits(b, reversed, count);
+}
+
+static void put_symbol(bit_writer_t *b, int symbol) {
+    if (symbol < 144) {
+        put_code(b, 0x30 + symbol, 8);
+    } else if (symbol < 256) {
+        put_code(b, 0x190 + symbol - 144, 9);
+    } else if (symbol < 280) {
+        put_code(b, symbol - 256, 7);
+    } else {
+        put_code(b, 0xC0 + symbol - 280, 8);
+    }
+}
+
+static void put_match(bit_writer_t *b, size_t length, size_t distance) {
+    int i = (int)(sizeof(length_base) / sizeof(length_base[0])) - 1;
+    while (length_base[i] > length) {
+        i--;
+    }
+    put_symbol(b, 257 + i);
+    put_bits(b, (uint32_t)(length - length_base[i]), length_extra[i]);
+
+    i = (int)(sizeof(distance_base) / sizeof(distance_base[0])) - 1;
+    while (distance_base[i] > distance) {
+        i--;
+    }
+    put_code(b, (uint32_t)i, 5);
+    put_bits(b, (uint32_t)(distance - distance_base[i]), distance_extra[i]);
+}
+
+static size_t match_length(const uint8_t *data, size_t pos, size_t len, size_t distance) {
+    size_t n = 0;
+    if (distance > pos) {
+        return 0;
+    }
+    while (pos + n < len && n < MATCH_MAX && data[pos + n] == data[pos + n - distance]) {
+        n++;
+    }
+    return n;
+}
+
+static void deflate_fixed(writer_t *w, const uint8_t *data, size_t len, size_t stride) {
+    bit_writer_t b = { w, 0, 0 };
+    const size_t distances[] = { 3, stride };
+
+    put_bits(&b, 1, 1);  // BFINAL
+    put_bits(&b, 1, 2);  // BTYPE 01, fixed codes
+    for (size_t pos = 0; pos < len;) {
+        size_t best = 0;
+        size_t best_distance = 0;
+        for (size_t i = 0; i < sizeof(distances) / sizeof(distances[0]); i++) {
+            size_t n = match_length(data, pos, len, distances[i]);
+            if (n > best) {
+                best = n;
+                best_distance = distances[i];
+            }
+        }
+        if (best >= MATCH_MIN) {
+            put_match(&b, best, best_distance);
+            pos += best;
+        } else {
+            put_symbol(&b, data[pos++]);
+        }
+    }
+    put_symbol(&b, END_OF_BLOCK);
+    if (b.count > 0) {
+        put_bits(&b, 0, 8 - b.count);
+    }
+}
+
+// Length, type, data and the CRC over type and data
+static void put_chunk(writer_t *w, const char *type, const uint8_t *data, size_t len) {
+    put_u32(w, (uint32_t)len);
+    size_t start = w->len;
+    put_bytes(w, type, 4);
+    put_bytes(w, data, len);
+    put_u32(w, crc32(w->buf + start, len + 4));
+}
+
+bool png_encode_rgb565(const uint16_t *pixels, int width, int height, bool swapped, uint8_t **out, size_t *len) {
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    size_t stride = 1 + (size_t)width * 3;
+    size_t raw_len = (size_t)height * stride;
+    size_t idat_len = 2 + raw_len + raw_len / 8 + 8 + 4;  // Literals are 9 bits at worst
+
+    if (crc_table[1] == 0) {
+        crc_init();
+    }
+
+    // Scanlines with filter type 0, RGB888
+    uint8_t *raw = malloc(raw_len);
+    uint8_t *idat = malloc(idat_len);
+    writer_t w = { malloc(sizeof(signature) + 25 + 12 + idat_len + 12), 0 };
+    if (raw == NULL || idat == NULL || w.buf == NULL) {
+        free(raw);
+        free(idat);
+        free(w.buf);
+        return false;
+    }
+
+    uint8_t *p = raw;
+    for (int y = 0; y < height; y++) {
+        *p++ = 0;
+        for (int x = 0; x < width; x++) {
+            uint16_t c = pixels[y * width + x];
+            if (swapped) {
+                c = (uint16_t)((c >> 8) | (c << 8));
+            }
+            uint8_t r = (c >> 11) & 0x1F;
+            uint8_t g = (c >> 5) & 0x3F;
+            uint8_t b = c & 0x1F;
+            *p++ = (uint8_t)((r << 3) | (r >> 2));
+            *p++ = (uint8_t)((g << 2) | (g >> 4));
+            *p++ = (uint8_t)((b << 3) | (b >> 2));
+        }
+    }
+
+    // zlib stream: header, one fixed Huffman block, Adler-32
+    writer_t z = { idat, 0 };
+    z.buf[z.len++] = 0x78;
+    z.buf[z.len++] = 0x01;
+    deflate_fixed(&z, raw, raw_len, stride);
+    put_u32(&z, adler32(raw, raw_len));
+
+    uint8_t ihdr[13];
+    writer_t h = { ihdr, 0 };
+    put_u32(&h, (uint32_t)width);
+    put_u32(&h, (uint32_t)height);
+    ihdr[8] = 8;    // Bit depth
+    ihdr[9] = 2;    // Truecolour
+    ihdr[10] = 0;   // Deflate
+    ihdr[11] = 0;   // Adaptive filtering
+    ihdr[12] = 0;   // No interlace
+
+    put_bytes(&w, signature, sizeof(signature));
+    put_chunk(&w, "IHDR", ihdr, sizeof(ihdr));
+    put_chunk(&w, "IDAT", idat, z.len);
+    put_chunk(&w, "IEND", NULL, 0);
+
+    free(raw);
+    free(idat);
+    *out = w.buf;
+    *len = w.len;
+    return true;
+}
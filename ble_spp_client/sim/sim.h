@@ -0,0 +1,57 @@
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Host simulator of the remote's display. The firmware UI (SquareLine
+// screens, screen manager, status bar, bindings) runs on the vendored LVGL
+// against an in-memory framebuffer, driven by a script instead of BLE and
+// the button. Time is simulated, so a script renders the same pixels on
+// every run and snapshots can be compared byte for byte.
+
+// Same panel as lcd.h, LV_HOR_RES_MAX x LV_VER_RES_MAX
+#define SIM_HOR_RES 240
+#define SIM_VER_RES 320
+
+// Simulated time since start, also the LVGL tick
+uint32_t sim_clock_ms(void);
+
+// Wall clock, for timing the render
+uint64_t sim_wall_ns(void);
+
+// Statistics of one rendered frame
+typedef struct {
+    uint32_t at_ms;         // Simulated time
+    uint32_t render_us;     // Wall time of lv_timer_handler(), flushes included
+    uint32_t area_px;       // Invalidated area LVGL redrew
+    uint32_t flushes;       // flush_cb calls, one per draw buffer
+    uint32_t flushed_px;
+} sim_frame_t;
+
+// Register the framebuffer display driver. After lv_init().
+void sim_display_init(void);
+
+// Framebuffer in LVGL's byte swapped RGB565, SIM_HOR_RES x SIM_VER_RES
+const uint16_t *sim_display_framebuffer(void);
+
+// Start counting a frame, before lv_timer_handler()
+void sim_display_begin(void);
+
+// True when the pass since sim_display_begin() rendered, with its figures
+// (render_us is left to the caller)
+bool sim_display_end(sim_frame_t *frame);
+
+// Stand-ins for the firmware state the UI reads (BLE telemetry, ADC
+// battery, trip computer). Values are set by name from the script, in the
+// units of the firmware getters. False for an unknown name.
+bool sim_firmware_set(const char *name, int32_t value);
+
+// Names accepted by sim_firmware_set(), NULL past the last one
+const char *sim_firmware_name(size_t index);
+
+// Encode the framebuffer as an 8 bit RGB PNG into a malloc'ed buffer
+bool png_encode_rgb565(const uint16_t *pixels, int width, int height, bool swapped, uint8_t **out, size_t *len);
+
+#endif // SIM_H
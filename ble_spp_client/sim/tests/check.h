@@ -0,0 +1,31 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdio.h>
+
+// Assertions of the host tests. A failed check is reported with its line
+// and the test carries on, main() returns CHECK_RESULT().
+
+static int check_failures;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            fprintf(stderr, "%s:%d: CHECK(%s)\n", __FILE__, __LINE__, #cond); \
+            check_failures++;                                              \
+        }                                                                  \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                                      \
+    do {                                                                                \
+        long long check_a = (long long)(actual), check_e = (long long)(expected);       \
+        if (check_a != check_e) {                                                       \
+            fprintf(stderr, "%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__,    \
+                    #actual, check_a, check_e);                                         \
+            check_failures++;                                                           \
+        }                                                                               \
+    } while (0)
+
+#define CHECK_RESULT() (check_failures ? (fprintf(stderr, "%d failed\n", check_failures), 1) : 0)
+
+#endif // CHECK_H
@@ -0,0 +1,88 @@
+// button_actions.c: the screen cycle, riding mode and the diagnostics
+// overlay, one gesture at a time
+
+#include "button_actions.h"
+#include "check.h"
+
+// Riding change, and the screen when one is loaded
+#define CHECK_ACTION(action, r, l, s)    \
+    do {                                 \
+        button_action_t got = (action);  \
+        CHECK_EQ(got.riding, (r));       \
+        CHECK_EQ(got.load, (l));         \
+        if (l) {                         \
+            CHECK_EQ(got.screen, (s));   \
+        }                                \
+    } while (0)
+
+int main(void) {
+    button_actions_t st;
+
+    // Double press cycles, back to home after the last screen
+    button_actions_init(&st, UI_SCREEN_HOME);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_DOUBLE_PRESS, false),
+                 BUTTON_RIDING_KEEP, true, UI_SCREEN_DETAILED);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_DOUBLE_PRESS, false),
+                 BUTTON_RIDING_KEEP, true, UI_SCREEN_HOME);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_DOUBLE_PRESS, false),
+                 BUTTON_RIDING_KEEP, true, UI_SCREEN_DETAILED);
+
+    // Resumed on the detailed screen, the next one is home
+    button_actions_init(&st, UI_SCREEN_DETAILED);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_DOUBLE_PRESS, false),
+                 BUTTON_RIDING_KEEP, true, UI_SCREEN_HOME);
+
+    // A resume screen outside the cycle starts it from home
+    button_actions_init(&st, UI_SCREEN_DIAGNOSTICS);
+    CHECK_EQ(st.cycle_index, 0);
+
+    // Triple press enters riding mode without a screen, and leaves it onto
+    // home; a double press also leaves it
+    button_actions_init(&st, UI_SCREEN_DETAILED);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_TRIPLE_PRESS, false),
+                 BUTTON_RIDING_ENTER, false, 0);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_TRIPLE_PRESS, true),
+                 BUTTON_RIDING_LEAVE, true, UI_SCREEN_HOME);
+    button_actions_init(&st, UI_SCREEN_DETAILED);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_DOUBLE_PRESS, true),
+                 BUTTON_RIDING_LEAVE, true, UI_SCREEN_HOME);
+
+    // Click-hold toggles the figures over the cycle screen, a double press
+    // goes back to it without moving on
+    button_actions_init(&st, UI_SCREEN_DETAILED);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_CLICK_HOLD, false),
+                 BUTTON_RIDING_KEEP, true, UI_SCREEN_DIAGNOSTICS);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_CLICK_HOLD, false),
+                 BUTTON_RIDING_KEEP, true, UI_SCREEN_DETAILED);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_CLICK_HOLD, false),
+                 BUTTON_RIDING_KEEP, true, UI_SCREEN_DIAGNOSTICS);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_DOUBLE_PRESS, false),
+                 BUTTON_RIDING_KEEP, true, UI_SCREEN_DETAILED);
+
+    // From riding mode click-hold always shows the figures, even when they
+    // were shown before riding started
+    button_actions_init(&st, UI_SCREEN_HOME);
+    button_actions_handle(&st, BUTTON_EVENT_CLICK_HOLD, false);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_TRIPLE_PRESS, false),
+                 BUTTON_RIDING_ENTER, false, 0);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_CLICK_HOLD, true),
+                 BUTTON_RIDING_LEAVE, true, UI_SCREEN_DIAGNOSTICS);
+
+    // The rest are left to their own handlers
+    button_actions_init(&st, UI_SCREEN_HOME);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_CLICK, false), BUTTON_RIDING_KEEP, false, 0);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_LONG_PRESS, true), BUTTON_RIDING_KEEP, false, 0);
+    CHECK_ACTION(button_actions_handle(&st, BUTTON_EVENT_PRESSED, false), BUTTON_RIDING_KEEP, false, 0);
+
+    // The table: one entry per gesture, the holds on the long press time
+    button_gesture_t table[BUTTON_ACTIONS_GESTURE_COUNT];
+    button_actions_gestures(table, BUTTON_LONG_PRESS_TIME_MS);
+    for (size_t i = 0; i < BUTTON_ACTIONS_GESTURE_COUNT; i++) {
+        for (size_t j = 0; j < i; j++) {
+            CHECK(table[i].event != table[j].event);
+        }
+        CHECK(table[i].hold_ms == 0 || table[i].hold_ms == BUTTON_LONG_PRESS_TIME_MS);
+    }
+
+    return CHECK_RESULT();
+}
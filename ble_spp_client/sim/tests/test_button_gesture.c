@@ -0,0 +1,175 @@
+// button_gesture.c: the gesture table of button_actions.c fed with timelines
+// of the raw button level. The driver's debounce and gesture timer are
+// played the way button.c runs them: a change of level arms a 20 ms
+// timer that samples the level and hands it to button_gesture_edge(), and
+// button_gesture_next_ms() schedules the ticks. Time steps by 1 ms from an
+// arbitrary start, so the ms counter wraps where a case starts near it.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "button_actions.h"
+#include "check.h"
+
+// As button.c
+#define DEBOUNCE_TIME_MS 20
+
+#define MAX_EVENTS 8
+#define RUN_OUT_MS 1000  // After the last edge, for the last gesture to resolve
+
+// Filled in by button_actions_gestures(), as button_init() does
+static button_gesture_t gestures[BUTTON_ACTIONS_GESTURE_COUNT];
+
+// Raw level from at_ms on, ms since the start of the case
+typedef struct {
+    uint32_t at_ms;
+    bool pressed;
+} edge_t;
+
+// A gesture and when it fired, ms since the start of the case
+typedef struct {
+    uint32_t at_ms;
+    button_event_t event;
+} fired_t;
+
+typedef struct {
+    const char *name;
+    uint32_t start_ms;
+    const edge_t *edges;
+    size_t edge_count;
+    fired_t expected[MAX_EVENTS];
+    size_t expected_count;
+} case_t;
+
+typedef struct {
+    uint32_t start_ms;
+    uint32_t now_ms;
+    fired_t fired[MAX_EVENTS];
+    size_t count;
+    int presses;  // PRESSED less RELEASED, stays 0 or 1
+} recorder_t;
+
+static void record(button_event_t event, void *ctx) {
+    recorder_t *rec = ctx;
+
+    if (event == BUTTON_EVENT_PRESSED || event == BUTTON_EVENT_RELEASED) {
+        rec->presses += event == BUTTON_EVENT_PRESSED ? 1 : -1;
+        CHECK(rec->presses == 0 || rec->presses == 1);
+        return;
+    }
+    if (rec->count < MAX_EVENTS) {
+        rec->fired[rec->count] = (fired_t){ rec->now_ms - rec->start_ms, event };
+    }
+    rec->count++;
+}
+
+static void run(const case_t *c) {
+    button_gesture_state_t st;
+    recorder_t rec = { .start_ms = c->start_ms };
+    bool level = false;    // Raw level of the pin
+    bool sampled = false;  // Level last handed over by the debounce timer
+    bool debouncing = false;
+    bool ticking = false;
+    uint32_t debounce_at = 0;
+    uint32_t tick_at = 0;
+    size_t next_edge = 0;
+    uint32_t end = c->edges[c->edge_count - 1].at_ms + RUN_OUT_MS;
+
+    button_gesture_init(&st, gestures, BUTTON_ACTIONS_GESTURE_COUNT, BUTTON_DOUBLE_PRESS_TIME_MS);
+
+    for (uint32_t t = 0; t <= end; t++) {
+        uint32_t now = c->start_ms + t;
+        rec.now_ms = now;
+
+        while (next_edge < c->edge_count && c->edges[next_edge].at_ms == t) {
+            level = c->edges[next_edge++].pressed;
+        }
+
+        // The interrupt waits for the level the button is not at
+        if (!debouncing && level != sampled) {
+            debouncing = true;
+            debounce_at = now + DEBOUNCE_TIME_MS;
+        }
+
+        bool schedule = false;
+        if (debouncing && now == debounce_at) {
+            debouncing = false;
+            sampled = level;
+            button_gesture_edge(&st, level, now, record, &rec);
+            schedule = true;
+        }
+        if (ticking && now == tick_at) {
+            button_gesture_tick(&st, now, record, &rec);
+            schedule = true;
+        }
+        if (schedule) {
+            uint32_t next_ms = button_gesture_next_ms(&st, now);
+            ticking = next_ms != UINT32_MAX;
+            tick_at = now + next_ms;
+        }
+    }
+
+    // Everything resolved, nothing left to tick for
+    CHECK(!ticking);
+    CHECK_EQ(button_gesture_next_ms(&st, c->start_ms + end), UINT32_MAX);
+    CHECK_EQ(rec.presses, 0);
+
+    if (rec.count != c->expected_count) {
+        fprintf(stderr, "%s: %zu gestures, expected %zu\n", c->name, rec.count, c->expected_count);
+        check_failures++;
+        return;
+    }
+    for (size_t i = 0; i < rec.count; i++) {
+        if (rec.fired[i].event != c->expected[i].event || rec.fired[i].at_ms != c->expected[i].at_ms) {
+            fprintf(stderr, "%s: gesture %zu is %d at %u ms, expected %d at %u ms\n", c->name, i,
+                    rec.fired[i].event, (unsigned)rec.fired[i].at_ms, c->expected[i].event,
+                    (unsigned)c->expected[i].at_ms);
+            check_failures++;
+        }
+    }
+}
+
+// Each press and release lands DEBOUNCE_TIME_MS after its raw edge
+static const edge_t single[] = { { 0, true }, { 100, false } };
+static const edge_t twice[] = { { 0, true }, { 100, false }, { 200, true }, { 300, false } };
+static const edge_t thrice[] = {
+    { 0, true }, { 100, false }, { 200, true }, { 300, false }, { 400, true }, { 500, false },
+};
+static const edge_t held[] = { { 0, true }, { 1000, false } };
+static const edge_t click_held[] = { { 0, true }, { 100, false }, { 200, true }, { 1000, false } };
+static const edge_t bouncy[] = {
+    { 0, true }, { 3, false }, { 7, true }, { 12, false }, { 15, true },     // Contact bounce on press
+    { 100, false }, { 104, true }, { 109, false }, { 113, true }, { 118, false },
+};
+static const edge_t glitch[] = { { 0, true }, { 10, false } };
+static const edge_t late_second[] = { { 0, true }, { 100, false }, { 500, true }, { 600, false } };
+
+int main(void) {
+    button_actions_gestures(gestures, BUTTON_LONG_PRESS_TIME_MS);
+
+    const case_t cases[] = {
+        // The click gap is waited out, a third press could still follow
+        { "click", 0, single, 2, { { 420, BUTTON_EVENT_CLICK } }, 1 },
+        { "double", 0, twice, 4, { { 620, BUTTON_EVENT_DOUBLE_PRESS } }, 1 },
+        // Nothing is longer than three clicks, resolved on the release
+        { "triple", 0, thrice, 6, { { 520, BUTTON_EVENT_TRIPLE_PRESS } }, 1 },
+        // 500 ms after the debounced press, the release is not a click
+        { "long press", 0, held, 2, { { 520, BUTTON_EVENT_LONG_PRESS } }, 1 },
+        { "click hold", 0, click_held, 4, { { 720, BUTTON_EVENT_CLICK_HOLD } }, 1 },
+        // Bounces inside the debounce are sampled away
+        { "bounce", 0, bouncy, 10, { { 420, BUTTON_EVENT_CLICK } }, 1 },
+        { "glitch", 0, glitch, 2, { { 0 } }, 0 },
+        // A press after the click gap starts a new sequence
+        { "two clicks", 0, late_second, 4, { { 420, BUTTON_EVENT_CLICK }, { 920, BUTTON_EVENT_CLICK } }, 2 },
+        // The ms counter wraps between the edges of one gesture
+        { "double, wrap", UINT32_MAX - 250, twice, 4, { { 620, BUTTON_EVENT_DOUBLE_PRESS } }, 1 },
+        { "long press, wrap", UINT32_MAX - 100, held, 2, { { 520, BUTTON_EVENT_LONG_PRESS } }, 1 },
+        { "click hold, wrap", UINT32_MAX - 400, click_held, 4, { { 720, BUTTON_EVENT_CLICK_HOLD } }, 1 },
+        { "triple, wrap", UINT32_MAX - 519, thrice, 6, { { 520, BUTTON_EVENT_TRIPLE_PRESS } }, 1 },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        run(&cases[i]);
+    }
+
+    return CHECK_RESULT();
+}
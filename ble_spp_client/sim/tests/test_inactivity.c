@@ -0,0 +1,51 @@
+// inactivity.c: timeout, reset debounce and the ms timestamp wrapping
+
+#include "check.h"
+#include "inactivity.h"
+
+#define TIMEOUT_MS 1000
+#define DEBOUNCE_MS 10
+
+int main(void) {
+    inactivity_t st;
+
+    // Plain timeout, a connection keeps the remote awake
+    inactivity_init(&st, TIMEOUT_MS, DEBOUNCE_MS, 5000);
+    CHECK_EQ(inactivity_elapsed(&st, 5000), 0);
+    CHECK(!inactivity_expired(&st, 5000 + TIMEOUT_MS, false));
+    CHECK(inactivity_expired(&st, 5000 + TIMEOUT_MS + 1, false));
+    CHECK(!inactivity_expired(&st, 5000 + TIMEOUT_MS + 1, true));
+
+    // Started just before the wrap, expires just after it
+    uint32_t start = UINT32_MAX - 100;
+    inactivity_init(&st, TIMEOUT_MS, DEBOUNCE_MS, start);
+    CHECK_EQ(inactivity_elapsed(&st, start + 500), 500);
+    CHECK(!inactivity_expired(&st, 200, false));
+    CHECK(!inactivity_expired(&st, start + TIMEOUT_MS, false));
+    CHECK(inactivity_expired(&st, start + TIMEOUT_MS + 1, false));
+
+    // The first reset counts even when the debounce reaches across the wrap
+    inactivity_init(&st, TIMEOUT_MS, DEBOUNCE_MS, 3);
+    inactivity_reset(&st, 3);
+    CHECK_EQ(st.last_activity_ms, 3);
+
+    // Resets inside the debounce are dropped, either side of the wrap
+    inactivity_init(&st, TIMEOUT_MS, DEBOUNCE_MS, UINT32_MAX - 2000);
+    inactivity_reset(&st, UINT32_MAX - 4);
+    CHECK_EQ(st.last_activity_ms, UINT32_MAX - 4);
+    inactivity_reset(&st, 2);
+    CHECK_EQ(st.last_activity_ms, UINT32_MAX - 4);
+    inactivity_reset(&st, 5);
+    CHECK_EQ(st.last_activity_ms, 5);
+    CHECK_EQ(inactivity_elapsed(&st, 5 + TIMEOUT_MS), TIMEOUT_MS);
+    CHECK(!inactivity_expired(&st, 5 + TIMEOUT_MS, false));
+    CHECK(inactivity_expired(&st, 6 + TIMEOUT_MS, false));
+
+    // Activity near the timeout pushes it back across the wrap
+    inactivity_init(&st, TIMEOUT_MS, DEBOUNCE_MS, UINT32_MAX - 900);
+    inactivity_reset(&st, UINT32_MAX - 10);
+    CHECK(!inactivity_expired(&st, TIMEOUT_MS - 20, false));
+    CHECK(inactivity_expired(&st, TIMEOUT_MS, false));
+
+    return CHECK_RESULT();
+}
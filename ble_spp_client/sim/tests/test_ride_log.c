@@ -0,0 +1,290 @@
+// ride_log_page.c against tools/ride_log.py: rides are encoded into pages
+// with the firmware's encoder, laid out as a partition dump of the flash
+// ring and as a UART export, and decoded by the tool. Its CSV must give
+// back every record of every page still in the log, the time within the
+// rounding of one time unit, and the speed of vesc_speed.c's factors.
+//     test_ride_log <python> <tools/ride_log.py>
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "ride_log_page.h"
+#include "vesc_speed.h"
+
+#define RING_PAGES 32      // Sectors of the partition dump
+#define SESSIONS 4
+#define MAX_PAGES 64
+#define MAX_RECORDS 16000
+#define PERIOD_MS 200      // RIDE_LOG_PERIOD_MS
+#define CORRUPT_PAGE 3     // Of the UART export, index among the pages kept
+
+#define DUMP_PATH "ride_log_dump.bin"
+#define EXPORT_PATH "ride_log_export.txt"
+#define CSV_PATH "ride_log.csv"
+
+typedef struct {
+    uint32_t seq;
+    uint32_t session;
+    uint32_t now_ms;
+    int32_t values[RIDE_LOG_FIELD_COUNT];
+    uint32_t kmh_factor;
+} record_t;
+
+typedef struct {
+    uint8_t motor_pulley;
+    uint8_t wheel_pulley;
+    uint8_t wheel_diameter_mm;
+    uint8_t motor_poles;
+} gearing_t;
+
+static ride_log_page_t pages[MAX_PAGES];
+static size_t page_count;
+static record_t records[MAX_RECORDS];
+static size_t record_count;
+
+// xorshift32, the same rides on every host
+static uint32_t rng = 7;
+
+static uint32_t next_random(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static int32_t random_between(int32_t lo, int32_t hi) {
+    return lo + (int32_t)(next_random() % (uint32_t)(hi - lo + 1));
+}
+
+static int32_t clamp(int32_t v, int32_t lo, int32_t hi) {
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+static uint32_t crc32(const uint8_t *data, size_t len) {
+    uint32_t c = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        c ^= data[i];
+        for (int k = 0; k < 8; k++) {
+            c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+    }
+    return c ^ 0xFFFFFFFFu;
+}
+
+// As write_page() in ride_log.c, esp_rom_crc32_le(0, ...) is zlib's crc32
+static void seal(ride_log_writer_t *w, uint32_t session) {
+    ride_log_page_t *page = &w->page;
+
+    if (page->header.records == 0) {
+        return;
+    }
+    page->header.seq = (uint32_t)page_count;
+    page->header.session = session;
+    page->header.crc = crc32(page->payload, page->header.payload_len);
+    pages[page_count++] = *page;
+    page->header.records = 0;
+    page->header.payload_len = 0;
+}
+
+// As sample() in ride_log.c: connected rides with jittered periods, the
+// telemetry wandering and now and then jumping, links dropping in between
+static void ride(uint32_t session, const gearing_t *g, uint32_t start_ms, size_t count) {
+    ride_log_writer_t w = {0};
+    vesc_speed_factors_t factors;
+    int32_t v[RIDE_LOG_FIELD_COUNT] = { 0, 0, 420, 0, 0, 0, 80 };
+    uint32_t now_ms = start_ms;
+
+    vesc_speed_factors(g->motor_pulley, g->wheel_pulley, g->wheel_diameter_mm, g->motor_poles, &factors);
+    for (size_t i = 0; i < count && record_count < MAX_RECORDS; i++) {
+        now_ms += PERIOD_MS + random_between(-7, 13);
+        if (next_random() % 300 == 0) {
+            // Disconnected for a while, the page is written on the way
+            seal(&w, session);
+            now_ms += (uint32_t)random_between(2000, 60000);
+        }
+
+        v[RIDE_LOG_FIELD_THROTTLE] = clamp(v[RIDE_LOG_FIELD_THROTTLE] + random_between(-20, 20), 0, 255);
+        v[RIDE_LOG_FIELD_ERPM] = next_random() % 100 == 0 ? random_between(-2000000, 2000000)
+                                 : clamp(v[RIDE_LOG_FIELD_ERPM] + random_between(-900, 900), -20000, 60000);
+        v[RIDE_LOG_FIELD_VOLTAGE] = clamp(v[RIDE_LOG_FIELD_VOLTAGE] + random_between(-2, 1), 300, 420);
+        v[RIDE_LOG_FIELD_CURRENT_MOTOR] = random_between(-600, 1200);
+        v[RIDE_LOG_FIELD_CURRENT_IN] = clamp(v[RIDE_LOG_FIELD_CURRENT_IN] + random_between(-30, 30), -300, 600);
+        v[RIDE_LOG_FIELD_AMP_HOURS] += random_between(0, 1);
+        v[RIDE_LOG_FIELD_LINK] = clamp(v[RIDE_LOG_FIELD_LINK] + random_between(-5, 5), 0, 100);
+
+        if (w.page.header.records == 0) {
+            ride_log_page_start(&w, now_ms, g->motor_pulley, g->wheel_pulley, g->wheel_diameter_mm, g->motor_poles);
+        }
+        if (!ride_log_page_append(&w, v, now_ms)) {
+            seal(&w, session);
+            ride_log_page_start(&w, now_ms, g->motor_pulley, g->wheel_pulley, g->wheel_diameter_mm, g->motor_poles);
+            CHECK(ride_log_page_append(&w, v, now_ms));
+        }
+
+        record_t *r = &records[record_count++];
+        r->seq = (uint32_t)page_count;  // The page being filled, sealed next
+        r->session = session;
+        r->now_ms = now_ms;
+        memcpy(r->values, v, sizeof(v));
+        r->kmh_factor = factors.speed[VESC_SPEED_KMH];
+    }
+    seal(&w, session);
+}
+
+// Sectors in ring order, each page where write_page() put it, the oldest
+// overwritten and the unused ones erased
+static bool write_dump(void) {
+    static uint8_t sector[RIDE_LOG_PAGE_SIZE];
+    FILE *f = fopen(DUMP_PATH, "wb");
+
+    if (f == NULL) {
+        return false;
+    }
+    for (size_t index = 0; index < RING_PAGES; index++) {
+        memset(sector, 0xFF, sizeof(sector));
+        for (size_t seq = 0; seq < page_count; seq++) {
+            if (seq % RING_PAGES == index) {
+                size_t len = sizeof(pages[seq].header) + pages[seq].header.payload_len;
+                memset(sector, 0xFF, sizeof(sector));
+                memcpy(sector, &pages[seq], len);
+            }
+        }
+        fwrite(sector, 1, sizeof(sector), f);
+    }
+    return fclose(f) == 0;
+}
+
+// As export_task(), oldest first, between the log lines of other tasks.
+// One page is damaged on the way and must be dropped.
+static bool write_export(size_t first, size_t corrupt) {
+    FILE *f = fopen(EXPORT_PATH, "w");
+
+    if (f == NULL) {
+        return false;
+    }
+    fprintf(f, "I (1234) BLE_SPP: Notify 14 bytes\nRLOG begin %d\n", RING_PAGES);
+    for (size_t seq = first; seq < page_count; seq++) {
+        const uint8_t *bytes = (const uint8_t *)&pages[seq];
+        size_t len = sizeof(pages[seq].header) + pages[seq].header.payload_len;
+        fputs("RLOG ", f);
+        for (size_t i = 0; i < len; i++) {
+            uint8_t b = bytes[i];
+            if (seq == corrupt && i == sizeof(pages[seq].header) + 5) {
+                b ^= 0x10;
+            }
+            fprintf(f, "%02x", b);
+        }
+        fputs("\n", f);
+        if (seq % 5 == 0) {
+            fputs("W (5678) TRIP: Odometer not saved: ESP_ERR_NVS_NOT_ENOUGH_SPACE\n", f);
+        }
+    }
+    fputs("RLOG end\n", f);
+    return fclose(f) == 0;
+}
+
+// Decode with the tool, then every CSV line against the records of the
+// pages it should have kept, in order
+static void check_decode(const char *python, const char *tool, const char *input, size_t first, size_t skip) {
+    char command[1024];
+    char line[256];
+
+    snprintf(command, sizeof(command), "\"%s\" \"%s\" \"%s\" --csv %s > /dev/null", python, tool, input, CSV_PATH);
+    if (system(command) != 0) {
+        fprintf(stderr, "%s: the tool failed\n", input);
+        check_failures++;
+        return;
+    }
+    // The csv module ends its lines with \r\n
+    FILE *f = fopen(CSV_PATH, "r");
+    if (f == NULL || fgets(line, sizeof(line), f) == NULL ||
+        strcmp(line, "session,t_ms,speed_kmh,throttle,erpm,voltage_dv,current_motor_da,current_in_da,"
+                     "amp_hours_cah,link\r\n") != 0) {
+        fprintf(stderr, "%s: no CSV header\n", input);
+        check_failures++;
+        if (f != NULL) {
+            fclose(f);
+        }
+        return;
+    }
+
+    size_t next = 0;
+    size_t decoded = 0;
+    int failures_before = check_failures;
+    while (fgets(line, sizeof(line), f) != NULL && check_failures - failures_before < 10) {
+        uint32_t session;
+        uint64_t t_ms;
+        double speed;
+        int32_t v[RIDE_LOG_FIELD_COUNT];
+
+        if (sscanf(line, "%" SCNu32 ",%" SCNu64 ",%lf,%" SCNd32 ",%" SCNd32 ",%" SCNd32 ",%" SCNd32 ",%" SCNd32
+                         ",%" SCNd32 ",%" SCNd32, &session, &t_ms, &speed, &v[0], &v[1], &v[2], &v[3], &v[4],
+                   &v[5], &v[6]) != 10) {
+            fprintf(stderr, "%s: bad line %s", input, line);
+            check_failures++;
+            continue;
+        }
+        while (next < record_count && (records[next].seq < first || records[next].seq == skip)) {
+            next++;
+        }
+        if (next == record_count) {
+            fprintf(stderr, "%s: more records than were written\n", input);
+            check_failures++;
+            break;
+        }
+
+        const record_t *r = &records[next++];
+        double kmh = r->values[RIDE_LOG_FIELD_ERPM] * (r->kmh_factor / (double)(1 << VESC_SPEED_SHIFT));
+        CHECK_EQ(session, r->session);
+        CHECK(llabs((long long)t_ms - (long long)r->now_ms) <= RIDE_LOG_TIME_UNIT_MS / 2);
+        // Printed to 0.01, and the factor is rounded to half a unit of its fraction bits
+        double slack = 0.005 + fabs((double)r->values[RIDE_LOG_FIELD_ERPM]) / (2.0 * (1 << VESC_SPEED_SHIFT));
+        CHECK(fabs(speed - kmh) <= slack);
+        CHECK(memcmp(v, r->values, sizeof(v)) == 0);
+        decoded++;
+    }
+    fclose(f);
+
+    size_t expected = 0;
+    for (size_t i = 0; i < record_count; i++) {
+        expected += records[i].seq >= first && records[i].seq != skip;
+    }
+    CHECK_EQ(decoded, expected);
+    printf("%s: %zu records of %zu pages decoded\n", input, decoded, page_count - first - (skip < page_count));
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <python> <ride_log.py>\n", argv[0]);
+        return 2;
+    }
+
+    // Sessions are boots, the gearing changes in between and the second
+    // boot is short enough to leave its only page part filled
+    const gearing_t gearings[SESSIONS] = {
+        { 15, 36, 83, 14 },
+        { 15, 36, 83, 14 },
+        { 16, 36, 90, 14 },
+        { 1, 1, 110, 30 },   // Hub motor
+    };
+    const size_t lengths[SESSIONS] = { 3000, 40, 5000, 4000 };
+    uint32_t session = 41;
+    for (size_t i = 0; i < SESSIONS; i++) {
+        ride(session++, &gearings[i], (uint32_t)random_between(800, 3000), lengths[i]);
+    }
+    CHECK(page_count > RING_PAGES);
+    CHECK(page_count <= MAX_PAGES);
+
+    size_t first = page_count > RING_PAGES ? page_count - RING_PAGES : 0;
+    CHECK(write_dump());
+    CHECK(write_export(first, first + CORRUPT_PAGE));
+
+    check_decode(argv[1], argv[2], DUMP_PATH, first, SIZE_MAX);
+    check_decode(argv[1], argv[2], EXPORT_PATH, first, first + CORRUPT_PAGE);
+
+    return CHECK_RESULT();
+}
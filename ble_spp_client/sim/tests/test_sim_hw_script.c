@@ -0,0 +1,165 @@
+// sim_hw_script.c: the command parser against every line of the QEMU
+// script (its path is the first argument), and the lever's steps, ramps
+// and noise
+
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "sim_hw_script.h"
+
+#define LINE_LEN 128
+#define MAX_MARKS 16
+
+static void check_script(const char *path) {
+    char line[LINE_LEN];
+    char marks[MAX_MARKS][SIM_HW_LABEL_LEN];
+    size_t mark_count = 0;
+    int line_no = 0;
+    int commands = 0;
+    bool pressed = false;
+    FILE *f = fopen(path, "r");
+
+    if (f == NULL) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        check_failures++;
+        return;
+    }
+    while (fgets(line, sizeof(line), f) != NULL) {
+        sim_hw_cmd_t cmd;
+        line_no++;
+        if (!sim_hw_script_parse(line, &cmd)) {
+            fprintf(stderr, "%s:%d: not a command: %s", path, line_no, line);
+            check_failures++;
+            continue;
+        }
+        commands += cmd.type != SIM_HW_CMD_NONE;
+
+        // Edges alternate, as a real button makes them
+        if (cmd.type == SIM_HW_CMD_PRESS || cmd.type == SIM_HW_CMD_RELEASE) {
+            bool press = cmd.type == SIM_HW_CMD_PRESS;
+            if (press == pressed) {
+                fprintf(stderr, "%s:%d: button already %s\n", path, line_no, press ? "pressed" : "released");
+                check_failures++;
+            }
+            pressed = press;
+        }
+
+        // Sections are told apart by their label
+        if (cmd.type == SIM_HW_CMD_MARK) {
+            for (size_t i = 0; i < mark_count; i++) {
+                if (strcmp(marks[i], cmd.label) == 0) {
+                    fprintf(stderr, "%s:%d: section %s twice\n", path, line_no, cmd.label);
+                    check_failures++;
+                }
+            }
+            if (mark_count < MAX_MARKS) {
+                strcpy(marks[mark_count++], cmd.label);
+            }
+        }
+    }
+    fclose(f);
+
+    CHECK(commands > 0);
+    CHECK(mark_count > 0);
+    CHECK(!pressed);
+}
+
+static void check_parse(void) {
+    sim_hw_cmd_t cmd;
+
+    CHECK(sim_hw_script_parse("", &cmd) && cmd.type == SIM_HW_CMD_NONE);
+    CHECK(sim_hw_script_parse("  # wait 100", &cmd) && cmd.type == SIM_HW_CMD_NONE);
+
+    CHECK(sim_hw_script_parse("wait 230\n", &cmd));
+    CHECK_EQ(cmd.type, SIM_HW_CMD_WAIT);
+    CHECK_EQ(cmd.value, 230);
+
+    CHECK(sim_hw_script_parse("throttle 4095 2000", &cmd));
+    CHECK_EQ(cmd.type, SIM_HW_CMD_THROTTLE);
+    CHECK_EQ(cmd.value, 4095);
+    CHECK_EQ(cmd.over_ms, 2000);
+    CHECK(sim_hw_script_parse("throttle 0", &cmd));
+    CHECK_EQ(cmd.over_ms, 0);
+
+    CHECK(sim_hw_script_parse("mark riding", &cmd));
+    CHECK_EQ(cmd.type, SIM_HW_CMD_MARK);
+    CHECK(strcmp(cmd.label, "riding") == 0);
+    CHECK(sim_hw_script_parse("release", &cmd) && cmd.type == SIM_HW_CMD_RELEASE);
+
+    // Out of the ADC range, missing or extra arguments, unknown commands
+    CHECK(!sim_hw_script_parse("throttle 4096", &cmd));
+    CHECK(!sim_hw_script_parse("throttle -1", &cmd));
+    CHECK(!sim_hw_script_parse("throttle 100 -5", &cmd));
+    CHECK(!sim_hw_script_parse("noise 5000", &cmd));
+    CHECK(!sim_hw_script_parse("wait", &cmd));
+    CHECK(!sim_hw_script_parse("wait -1", &cmd));
+    CHECK(!sim_hw_script_parse("wait 10 20", &cmd));
+    CHECK(!sim_hw_script_parse("press 3", &cmd));
+    CHECK(!sim_hw_script_parse("snap", &cmd));
+    CHECK(!sim_hw_script_parse("jump 3", &cmd));
+}
+
+static void check_lever(void) {
+    sim_hw_lever_t lever;
+
+    sim_hw_lever_init(&lever);
+    CHECK_EQ(sim_hw_lever_read(&lever, 0), 0);
+
+    // A step is there at once
+    sim_hw_lever_move(&lever, 3000, 0, 1000);
+    CHECK_EQ(sim_hw_lever_read(&lever, 1000), 3000);
+
+    // A ramp goes linearly from where the lever is, and stays at the end
+    sim_hw_lever_move(&lever, 1000, 2000, 10000);
+    CHECK_EQ(sim_hw_lever_read(&lever, 10000), 3000);
+    CHECK_EQ(sim_hw_lever_read(&lever, 10000 + 500000), 2500);
+    CHECK_EQ(sim_hw_lever_read(&lever, 10000 + 2000000), 1000);
+    CHECK_EQ(sim_hw_lever_read(&lever, 10000 + 5000000), 1000);
+
+    // Turned round halfway through a ramp, from the point it had reached
+    sim_hw_lever_move(&lever, 4000, 1000, 20000000);
+    sim_hw_lever_move(&lever, 0, 1000, 20500000);
+    CHECK_EQ(sim_hw_lever_position(&lever, 20500000), 2500);
+    CHECK_EQ(sim_hw_lever_position(&lever, 21000000), 1250);
+
+    // Noise stays within its peak, covers both sides and clamps at the ends
+    sim_hw_lever_move(&lever, 2048, 0, 0);
+    sim_hw_lever_set_noise(&lever, 12);
+    int32_t lo = 2048;
+    int32_t hi = 2048;
+    for (int i = 0; i < 10000; i++) {
+        int32_t v = sim_hw_lever_read(&lever, 0);
+        lo = v < lo ? v : lo;
+        hi = v > hi ? v : hi;
+    }
+    CHECK_EQ(lo, 2048 - 12);
+    CHECK_EQ(hi, 2048 + 12);
+    sim_hw_lever_move(&lever, SIM_HW_ADC_MAX_RAW, 0, 0);
+    for (int i = 0; i < 1000; i++) {
+        CHECK(sim_hw_lever_read(&lever, 0) <= SIM_HW_ADC_MAX_RAW);
+    }
+
+    // The same sequence on every run
+    sim_hw_lever_t a, b;
+    sim_hw_lever_init(&a);
+    sim_hw_lever_init(&b);
+    sim_hw_lever_set_noise(&a, 50);
+    sim_hw_lever_set_noise(&b, 50);
+    sim_hw_lever_move(&a, 1000, 0, 0);
+    sim_hw_lever_move(&b, 1000, 0, 0);
+    for (int i = 0; i < 100; i++) {
+        CHECK_EQ(sim_hw_lever_read(&a, 0), sim_hw_lever_read(&b, 0));
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <script>\n", argv[0]);
+        return 2;
+    }
+
+    check_parse();
+    check_lever();
+    check_script(argv[1]);
+    return CHECK_RESULT();
+}
@@ -0,0 +1,51 @@
+// throttle_map.c: empty ranges, clamping and the offset above the minimum
+
+#include <stdint.h>
+#include "check.h"
+#include "throttle_map.h"
+
+#define MIN 1100
+#define MAX 3300
+
+int main(void) {
+    // No range, nothing is sent
+    CHECK_EQ(throttle_map(2000, MAX, MAX), 0);
+    CHECK_EQ(throttle_map(2000, MAX, MIN), 0);
+    CHECK_EQ(throttle_map(0, 0, 0), 0);
+    CHECK_EQ(throttle_map(UINT32_MAX, 1, 0), 0);
+
+    // Clamped to the range
+    CHECK_EQ(throttle_map(0, MIN, MAX), 0);
+    CHECK_EQ(throttle_map(MIN - 1, MIN, MAX), 0);
+    CHECK_EQ(throttle_map(MIN, MIN, MAX), 0);
+    CHECK_EQ(throttle_map(MAX, MIN, MAX), THROTTLE_MAP_MAX);
+    CHECK_EQ(throttle_map(MAX + 1, MIN, MAX), THROTTLE_MAP_MAX);
+    CHECK_EQ(throttle_map(UINT32_MAX, MIN, MAX), THROTTLE_MAP_MAX);
+
+    // Steps too small to map stay at 0, the first one that does jumps to
+    // the offset
+    uint32_t span = MAX - MIN;
+    uint32_t steps = THROTTLE_MAP_MAX - THROTTLE_MAP_OFFSET;
+    uint32_t first = MIN + (span + steps - 1) / steps;
+    CHECK_EQ(throttle_map(first - 1, MIN, MAX), 0);
+    CHECK_EQ(throttle_map(first, MIN, MAX), THROTTLE_MAP_OFFSET + 1);
+
+    // Monotonic over the whole range, never between 0 and the offset
+    uint8_t previous = 0;
+    for (uint32_t raw = MIN; raw <= MAX; raw++) {
+        uint8_t mapped = throttle_map(raw, MIN, MAX);
+        CHECK(mapped >= previous);
+        CHECK(mapped == 0 || mapped > THROTTLE_MAP_OFFSET);
+        previous = mapped;
+    }
+
+    // One count of range, either end
+    CHECK_EQ(throttle_map(MIN, MIN, MIN + 1), 0);
+    CHECK_EQ(throttle_map(MIN + 1, MIN, MIN + 1), THROTTLE_MAP_MAX);
+
+    // The widest range of the 12 bit ADC
+    CHECK_EQ(throttle_map(4095, 0, 4095), THROTTLE_MAP_MAX);
+    CHECK_EQ(throttle_map(2048, 0, 4095), (2048 * 237) / 4095 + THROTTLE_MAP_OFFSET);
+
+    return CHECK_RESULT();
+}
@@ -0,0 +1,123 @@
+// trip_integrator.c: a ten hour ride of random telemetry integrated the
+// way trip.c ticks it, against the same integral in doubles. With the
+// remainders carried the integer totals stay within one unit of the
+// reference at every step, where truncating each step on its own would
+// lose up to a unit per step.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "check.h"
+#include "trip_integrator.h"
+#include "vesc_speed.h"
+
+// As trip.h
+#define TRIP_PERIOD_MS 100
+#define TRIP_MAX_GAP_MS 500
+
+#define RIDE_MS (10UL * 3600 * 1000)
+
+// Float error of the reference over the whole ride is well below this
+#define REFERENCE_SLACK 0.01
+
+// xorshift32, the same trace on every host
+static uint32_t rng = 1;
+
+static uint32_t next_random(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static int32_t random_between(int32_t lo, int32_t hi) {
+    return lo + (int32_t)(next_random() % (uint32_t)(hi - lo + 1));
+}
+
+static int32_t clamp(int32_t v, int32_t lo, int32_t hi) {
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+int main(void) {
+    trip_integrator_t st;
+    uint32_t distance_mm = 0;
+    int32_t energy_mwh = 0;
+    double distance_ref = 0;
+    double energy_ref = 0;
+    double distance_drift = 0;
+    double energy_drift = 0;
+    int32_t erpm = 0;
+    int32_t voltage_dv = 420;
+    int32_t current_in_da = 0;
+    uint32_t steps = 0;
+    uint64_t truncated_mm = 0;  // Each step on its own, for comparison
+
+    // 15/36 on 83 mm wheels and 14 poles, then a config change to 90 mm
+    vesc_speed_factors_t before, after;
+    vesc_speed_factors(15, 36, 83, 14, &before);
+    vesc_speed_factors(15, 36, 90, 14, &after);
+    uint32_t factor = before.nm_per_erev;
+
+    trip_integrator_init(&st);
+    for (uint64_t t = 0; t < RIDE_MS; steps++) {
+        // Ticks jitter around the period, now and then a stalled worker
+        uint32_t dt_ms = next_random() % 500 == 0 ? TRIP_MAX_GAP_MS : (uint32_t)random_between(80, 120);
+        t += dt_ms;
+        if (t >= RIDE_MS / 2) {
+            factor = after.nm_per_erev;
+        }
+
+        // Random walks: forwards and back, the pack sagging under load and
+        // recovering, regen pulling the input current negative
+        erpm = clamp(erpm + random_between(-1500, 1500), -20000, 60000);
+        current_in_da = clamp(current_in_da + random_between(-40, 40), -300, 500);
+        voltage_dv = clamp(voltage_dv + random_between(-2, 2) - current_in_da / 250, 330, 420);
+
+        distance_mm += trip_integrator_distance_mm(&st, erpm, factor, dt_ms);
+        energy_mwh += trip_integrator_energy_mwh(&st, voltage_dv, current_in_da, dt_ms);
+
+        truncated_mm += (uint64_t)fabs((double)erpm) * dt_ms * factor / TRIP_INTEGRATOR_DISTANCE_DIVISOR;
+        distance_ref += fabs((double)erpm) * dt_ms * factor / (double)TRIP_INTEGRATOR_DISTANCE_DIVISOR;
+        energy_ref += (double)voltage_dv * current_in_da * dt_ms / TRIP_INTEGRATOR_ENERGY_DIVISOR;
+
+        // Distance truncates towards the reference, energy towards zero
+        double d = distance_ref - distance_mm;
+        double e = energy_ref - energy_mwh;
+        if (d < -REFERENCE_SLACK || d >= 1 + REFERENCE_SLACK || fabs(e) >= 1 + REFERENCE_SLACK) {
+            fprintf(stderr, "step %u: %u mm (%.3f), %d mWh (%.3f)\n", (unsigned)steps, (unsigned)distance_mm,
+                    distance_ref, (int)energy_mwh, energy_ref);
+            check_failures++;
+            break;
+        }
+        distance_drift = fmax(distance_drift, fabs(d));
+        energy_drift = fmax(energy_drift, fabs(e));
+    }
+
+    printf("%u steps, %.3f km, %.3f Wh, largest drift %.3f mm and %.3f mWh, %.0f mm without the carry\n",
+           (unsigned)steps, distance_ref / 1e6, energy_ref / 1e3, distance_drift, energy_drift,
+           distance_ref - truncated_mm);
+
+    // The ride went somewhere and used energy, the test is not vacuous
+    CHECK(distance_mm > 100000000);
+    CHECK(energy_mwh > 100000);
+
+    // Ends of the ranges in one step: the carry starts from zero each time
+    trip_integrator_init(&st);
+    CHECK_EQ(trip_integrator_distance_mm(&st, INT32_MIN / 4096, factor, TRIP_MAX_GAP_MS),
+             (uint32_t)((double)(-(INT32_MIN / 4096)) * TRIP_MAX_GAP_MS * factor / TRIP_INTEGRATOR_DISTANCE_DIVISOR));
+    trip_integrator_init(&st);
+    CHECK_EQ(trip_integrator_energy_mwh(&st, INT16_MAX, INT16_MIN, TRIP_MAX_GAP_MS),
+             (int32_t)((double)INT16_MAX * INT16_MIN * TRIP_MAX_GAP_MS / TRIP_INTEGRATOR_ENERGY_DIVISOR));
+
+    // Regen and drive cancel out exactly, remainders included
+    trip_integrator_init(&st);
+    int32_t net = 0;
+    for (int i = 0; i < 1000; i++) {
+        net += trip_integrator_energy_mwh(&st, 400, 7, TRIP_PERIOD_MS);
+        net += trip_integrator_energy_mwh(&st, 400, -7, TRIP_PERIOD_MS);
+    }
+    CHECK_EQ(net, 0);
+    CHECK_EQ(st.energy_acc, 0);
+
+    return CHECK_RESULT();
+}
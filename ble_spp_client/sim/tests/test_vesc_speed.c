@@ -0,0 +1,89 @@
+// vesc_speed.c: factors against a double reference, invalid gearing and
+// the conversion either side of zero
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "vesc_speed.h"
+
+static void check_invalid(uint8_t motor_pulley, uint8_t wheel_pulley, uint8_t wheel_diameter_mm, uint8_t motor_poles) {
+    vesc_speed_factors_t f;
+
+    memset(&f, 0xA5, sizeof(f));
+    CHECK(!vesc_speed_factors(motor_pulley, wheel_pulley, wheel_diameter_mm, motor_poles, &f));
+    CHECK_EQ(f.speed[VESC_SPEED_KMH], 0);
+    CHECK_EQ(f.speed[VESC_SPEED_MPH], 0);
+    CHECK_EQ(f.nm_per_erev, 0);
+}
+
+// Whole units the conversion has to land on, or one below where the factor
+// rounding crosses an integer
+static void check_speed(int32_t erpm, uint32_t factor, double per_erpm) {
+    double exact = erpm * per_erpm;
+    int32_t speed = vesc_speed_from_erpm(erpm, factor);
+
+    CHECK(fabs(speed - trunc(exact)) <= 1);
+    CHECK((speed < 0) == (exact <= -1));
+}
+
+int main(void) {
+    vesc_speed_factors_t f;
+
+    // 15/36 reduction, 83 mm wheels, 14 poles
+    CHECK(vesc_speed_factors(15, 36, 83, 14, &f));
+    double metres = 15.0 / (7 * 36) * 83 * 3.14159265358979323846 / 1000.0;
+    double kmh = metres * 60.0 / 1000.0;
+    double mph = kmh / 1.609344;
+    CHECK(fabs(f.speed[VESC_SPEED_KMH] / (double)(1 << VESC_SPEED_SHIFT) - kmh) < 1.0 / (1 << VESC_SPEED_SHIFT));
+    CHECK(fabs(f.speed[VESC_SPEED_MPH] / (double)(1 << VESC_SPEED_SHIFT) - mph) < 1.0 / (1 << VESC_SPEED_SHIFT));
+    CHECK(fabs(f.nm_per_erev - metres * 1e9) <= 0.5);
+
+    CHECK_EQ(vesc_speed_from_erpm(30000, f.speed[VESC_SPEED_KMH]), 27);
+    CHECK_EQ(vesc_speed_from_erpm(30000, f.speed[VESC_SPEED_MPH]), 17);
+    CHECK_EQ(vesc_speed_from_erpm(-30000, f.speed[VESC_SPEED_KMH]), -27);
+    CHECK_EQ(vesc_speed_from_erpm(-30000, f.speed[VESC_SPEED_MPH]), -17);
+    CHECK_EQ(vesc_speed_from_erpm(0, f.speed[VESC_SPEED_KMH]), 0);
+    CHECK_EQ(vesc_speed_from_erpm(1000, 0), 0);
+
+    // Truncated towards zero on both sides, against the reference
+    srand(1);
+    for (int i = 0; i < 100000; i++) {
+        int32_t erpm = (rand() % 200001) - 100000;
+        check_speed(erpm, f.speed[VESC_SPEED_KMH], kmh);
+        check_speed(erpm, f.speed[VESC_SPEED_MPH], mph);
+    }
+
+    // No overflow at the ends of the eRPM range, against the rounded factor
+    double factor = f.speed[VESC_SPEED_KMH] / (double)(1 << VESC_SPEED_SHIFT);
+    CHECK_EQ(vesc_speed_from_erpm(INT32_MAX, f.speed[VESC_SPEED_KMH]), (int32_t)(INT32_MAX * factor));
+    CHECK_EQ(vesc_speed_from_erpm(INT32_MIN, f.speed[VESC_SPEED_KMH]), -(int32_t)(-(double)INT32_MIN * factor));
+
+    // Direct drive, the largest wheel: one wheel turn per electrical turn
+    CHECK(vesc_speed_factors(1, 1, 255, 2, &f));
+    CHECK(fabs(f.speed[VESC_SPEED_KMH] / (double)(1 << VESC_SPEED_SHIFT) - 0.255 * 3.14159265358979323846 * 0.06) < 1e-6);
+    CHECK(fabs(f.nm_per_erev - 255e6 * 3.14159265358979323846) <= 0.5);
+
+    // Hub motor, 8 poles on 90 mm
+    CHECK(vesc_speed_factors(1, 1, 90, 8, &f));
+    CHECK(fabs(f.nm_per_erev - 90e6 * 3.14159265358979323846 / 4) <= 0.5);
+
+    // Geared up so far that a turn is 4.3 m or more, the distance does not fit
+    CHECK(vesc_speed_factors(5, 1, 255, 2, &f));
+    CHECK(fabs(f.nm_per_erev - 5 * 255e6 * 3.14159265358979323846) <= 0.5);
+    check_invalid(6, 1, 255, 2);
+    check_invalid(255, 1, 255, 2);
+
+    // Pole counts: odd, zero and a single pole have no pole pair count
+    check_invalid(15, 36, 83, 13);
+    check_invalid(15, 36, 83, 0);
+    check_invalid(15, 36, 83, 1);
+
+    // Zero pulleys or wheel
+    check_invalid(15, 0, 83, 14);
+    check_invalid(0, 36, 83, 14);
+    check_invalid(0, 0, 83, 14);
+    check_invalid(15, 36, 0, 14);
+
+    return CHECK_RESULT();
+}
@@ -0,0 +1,65 @@
+// vesc_telemetry.c: byte order, sign extension and frame length
+
+#include <string.h>
+#include "check.h"
+#include "vesc_telemetry.h"
+
+static const uint8_t frame[VESC_TELEMETRY_LEN] = {
+    0x0F, 0xA0,              // 40.00 V
+    0x00, 0x01, 0x86, 0xA0,  // 100000 eRPM
+    0x04, 0xD2,              // 12.34 A
+    0x02, 0x37,              // 5.67 A
+    0x01, 0x2C,              // 3.00 Ah
+    0x00, 0x0A,              // 0.10 Ah
+};
+
+static const uint8_t negative[VESC_TELEMETRY_LEN] = {
+    0x80, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x38,
+    0xFE, 0x0C,
+    0x7F, 0xFF,
+    0x80, 0x00,
+};
+
+int main(void) {
+    vesc_telemetry_t t;
+
+    CHECK(vesc_telemetry_decode(frame, sizeof(frame), &t));
+    CHECK_EQ(t.voltage_cv, 4000);
+    CHECK_EQ(t.erpm, 100000);
+    CHECK_EQ(t.current_motor_ca, 1234);
+    CHECK_EQ(t.current_in_ca, 567);
+    CHECK_EQ(t.amp_hours_cah, 300);
+    CHECK_EQ(t.amp_hours_charged_cah, 10);
+
+    // Regenerating and reversing: every field sign extends
+    CHECK(vesc_telemetry_decode(negative, sizeof(negative), &t));
+    CHECK_EQ(t.voltage_cv, INT16_MIN);
+    CHECK_EQ(t.erpm, -1);
+    CHECK_EQ(t.current_motor_ca, -200);
+    CHECK_EQ(t.current_in_ca, -500);
+    CHECK_EQ(t.amp_hours_cah, INT16_MAX);
+    CHECK_EQ(t.amp_hours_charged_cah, INT16_MIN);
+
+    uint8_t extremes[VESC_TELEMETRY_LEN];
+    memcpy(extremes, frame, sizeof(extremes));
+    memcpy(extremes + 2, (const uint8_t[]){0x80, 0x00, 0x00, 0x00}, 4);
+    CHECK(vesc_telemetry_decode(extremes, sizeof(extremes), &t));
+    CHECK_EQ(t.erpm, INT32_MIN);
+    memcpy(extremes + 2, (const uint8_t[]){0x7F, 0xFF, 0xFF, 0xFF}, 4);
+    CHECK(vesc_telemetry_decode(extremes, sizeof(extremes), &t));
+    CHECK_EQ(t.erpm, INT32_MAX);
+
+    // Short and long frames are refused and leave the output alone
+    uint8_t longer[VESC_TELEMETRY_LEN + 1] = {0};
+    vesc_telemetry_t before;
+    memset(&t, 0x5A, sizeof(t));
+    before = t;
+    CHECK(!vesc_telemetry_decode(frame, 0, &t));
+    CHECK(!vesc_telemetry_decode(frame, VESC_TELEMETRY_LEN - 1, &t));
+    CHECK(!vesc_telemetry_decode(longer, sizeof(longer), &t));
+    CHECK(memcmp(&t, &before, sizeof(t)) == 0);
+
+    return CHECK_RESULT();
+}
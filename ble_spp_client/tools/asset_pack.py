@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+"""Build the asset pack that is flashed to the `assets` partition.
+
+Input is the SquareLine export of squareline/assets, i.e. main/ui/images/*.c
+(after tools/img_pack.py) and main/ui/fonts/*.c. Their pixel and glyph data
+is moved into assets.bin, and for every input file a C file is generated
+that keeps the small descriptors (image header, glyph table, cmaps, kerning)
+in the app with the data pointer left NULL. asset_pack_init() points them
+at the memory mapped partition at boot.
+
+Pack layout (little endian), see asset_pack.h:
+    header   u32 magic, u16 version, u16 entry count,
+             u32 layout id, u32 pack size, u32 crc32 of everything after the header
+    entries  char name[32], u32 offset from the start of the pack, u32 size
+    data     4 byte aligned blobs
+
+The layout id covers entry names and sizes. As long as it matches, the pack
+can be reflashed with `idf.py assets-flash` without rebuilding the app.
+
+Called by main/CMakeLists.txt:
+    python tools/asset_pack.py --out build/... main/ui/images/*.c main/ui/fonts/*.c
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import img_pack  # noqa: E402
+
+# Must match asset_pack.h
+PACK_MAGIC = 0x50414247  # "GBAP"
+PACK_VERSION = 1
+NAME_LEN = 32
+HEADER_FMT = "<IHHIII"
+ENTRY_FMT = "<%dsII" % NAME_LEN
+ALIGN = 4
+
+GENERATED_NOTE = "// Generated by tools/asset_pack.py from %s, do not edit.\n"
+
+BITMAP_RE = re.compile(r"static\s+LV_ATTRIBUTE_LARGE_CONST\s+const\s+uint8_t\s+glyph_bitmap\[\]\s*=\s*\{(.*?)\n\};", re.S)
+FONT_NAME_RE = re.compile(r"const\s+lv_font_t\s+(\w+)\s*=\s*\{")
+FONT_GUARD_END_RE = re.compile(r"#endif\s*/\*#if\s+\w+\*/\s*$")
+HEX_RE = re.compile(r"0x([0-9A-Fa-f]+)")
+
+
+def parse_font(text):
+    m = BITMAP_RE.search(text)
+    name = FONT_NAME_RE.search(text)
+    if not m or not name:
+        return None
+    body = re.sub(r"/\*.*?\*/", "", m.group(1), flags=re.S)
+    bitmap = bytes(int(b, 16) for b in HEX_RE.findall(body))
+    return name.group(1), bitmap, m
+
+
+def font_source(path, text, name, size, match):
+    """The font file without its glyph bitmap, with a writable descriptor."""
+    out = text[:match.start()] + "/*Glyph bitmaps are in the asset partition, see asset_pack.c*/" + text[match.end():]
+    out = out.replace('#include "../ui.h"', '#include "asset_pack.h"', 1)
+    out = out.replace("static const lv_font_fmt_txt_dsc_t font_dsc", "static lv_font_fmt_txt_dsc_t font_dsc", 1)
+    out = out.replace(".glyph_bitmap = glyph_bitmap,", ".glyph_bitmap = NULL,", 1)
+    if ".glyph_bitmap = NULL," not in out or "static lv_font_fmt_txt_dsc_t font_dsc = {" not in out:
+        sys.exit("%s: unexpected font layout" % path)
+
+    binding = ("const asset_binding_t asset_binding_%s = {\n"
+               "    .name = \"%s\",\n"
+               "    .size = %d,\n"
+               "    .font = &font_dsc,\n"
+               "};\n\n") % (name, name, size)
+    end = FONT_GUARD_END_RE.search(out)
+    if end:
+        out = out[:end.start()] + binding + out[end.start():]
+    else:
+        out += "\n" + binding
+    return GENERATED_NOTE % os.path.basename(path) + out
+
+
+def image_source(path, img):
+    name = img["name"]
+    return (
+        GENERATED_NOTE % os.path.basename(path) +
+        "// IMAGE DATA: %s, mapped from the asset partition by asset_pack_init()\n"
+        "\n"
+        "#include \"asset_pack.h\"\n"
+        "\n"
+        "// Not const: data is filled in at boot\n"
+        "lv_img_dsc_t %s = {\n"
+        "    .header.always_zero = 0,\n"
+        "    .header.w = %d,\n"
+        "    .header.h = %d,\n"
+        "    .data_size = %d,\n"
+        "    .header.cf = %s,\n"
+        "    .data = NULL\n"
+        "};\n"
+        "\n"
+        "const asset_binding_t asset_binding_%s = {\n"
+        "    .name = \"%s\",\n"
+        "    .size = %d,\n"
+        "    .img = &%s,\n"
+        "};\n"
+    ) % (img["source"], name, img["w"], img["h"], len(img["data"]), img["cf"],
+         name, name, len(img["data"]), name)
+
+
+def bindings_source(names, layout_id):
+    lines = [GENERATED_NOTE % "the asset list", "#include \"asset_pack.h\"\n", "\n"]
+    for name in names:
+        lines.append("extern const asset_binding_t asset_binding_%s;\n" % name)
+    lines.append("\nconst asset_binding_t *const asset_bindings[] = {\n")
+    for name in names:
+        lines.append("    &asset_binding_%s,\n" % name)
+    lines.append("};\n\n")
+    lines.append("const size_t asset_binding_count = sizeof(asset_bindings) / sizeof(asset_bindings[0]);\n")
+    lines.append("const uint32_t asset_pack_layout_id = 0x%08X;\n" % layout_id)
+    return "".join(lines)
+
+
+def build_pack(blobs):
+    names = sorted(blobs)
+    layout_id = 0
+    for name in names:
+        layout_id = zlib.crc32(("%s:%d;" % (name, len(blobs[name]))).encode(), layout_id)
+
+    header_size = struct.calcsize(HEADER_FMT)
+    offset = header_size + len(names) * struct.calcsize(ENTRY_FMT)
+    table = b""
+    data = b""
+    for name in names:
+        pad = (-(offset + len(data))) % ALIGN
+        data += bytes(pad)
+        table += struct.pack(ENTRY_FMT, name.encode(), offset + len(data), len(blobs[name]))
+        data += blobs[name]
+
+    body = table + data
+    header = struct.pack(HEADER_FMT, PACK_MAGIC, PACK_VERSION, len(names), layout_id,
+                         header_size + len(body), zlib.crc32(body))
+    return header + body, names, layout_id
+
+
+def write_if_changed(path, text):
+    # Keeps the generated sources from being rebuilt when nothing changed
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return
+    with open(path, "w") as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("sources", nargs="+", help="SquareLine image and font .c files")
+    parser.add_argument("--out", required=True, help="directory for assets.bin and the generated sources")
+    args = parser.parse_args()
+
+    os.makedirs(args.out, exist_ok=True)
+    blobs = {}
+    for path in args.sources:
+        with open(path) as f:
+            text = f.read()
+
+        img = img_pack.parse_image(text)
+        if img is not None:
+            blobs[img["name"]] = img["data"]
+            out = image_source(path, img)
+        else:
+            font = parse_font(text)
+            if font is None:
+                sys.exit("%s: neither an image nor a font" % path)
+            name, bitmap, match = font
+            blobs[name] = bitmap
+            out = font_source(path, text, name, len(bitmap), match)
+
+        write_if_changed(os.path.join(args.out, os.path.basename(path)), out)
+
+    if len(blobs) != len(args.sources):
+        sys.exit("duplicate asset names")
+    for name in blobs:
+        if len(name) >= NAME_LEN:
+            sys.exit("%s: name longer than %d characters" % (name, NAME_LEN - 1))
+
+    pack, names, layout_id = build_pack(blobs)
+    write_if_changed(os.path.join(args.out, "asset_bindings.c"), bindings_source(names, layout_id))
+    with open(os.path.join(args.out, "assets.bin"), "wb") as f:
+        f.write(pack)
+
+    print("asset pack: %d assets, %d bytes moved out of the app, %d byte pack, layout 0x%08X" %
+          (len(names), sum(len(b) for b in blobs.values()), len(pack), layout_id))
+
+
+if __name__ == "__main__":
+    main()
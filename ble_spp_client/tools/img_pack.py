@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""Repack SquareLine image exports for a fixed, opaque background.
+
+SquareLine exports every PNG as LV_IMG_CF_TRUE_COLOR_ALPHA (RGB565 + alpha,
+3 bytes per pixel), so LVGL alpha-blends every pixel on every draw. All our
+screens are solid black, so the blend can be done once here instead:
+
+  * RGB565   - pre-blended LV_IMG_CF_TRUE_COLOR, 2 bytes per pixel, drawn by
+               the built-in decoder with a plain copy.
+  * RLE      - pre-blended, palette indexed and run-length encoded per row,
+               decoded line by line by main/img_rle.c (LV_IMG_CF_USER_ENCODED_0).
+               Only for images that are never zoomed or rotated: LVGL needs
+               the whole decoded image in memory to transform it.
+
+The .c files are rewritten in place, already converted files are skipped, so
+the script can be re-run after every SquareLine export:
+
+    python tools/img_pack.py main/ui/images
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# Background every asset is shown on (RGB888)
+DEFAULT_BACKGROUND = 0x000000
+
+# Large, untransformed images that may be stored as RLE. Everything else is
+# kept as plain RGB565 because the home screen zooms its icons.
+RLE_ASSETS = {
+    "ui_img_gb_png",
+    "ui_img_design_sem_nome_png",
+    "ui_img_38597039",
+}
+
+# Must match img_rle.h
+RLE_MAX_RUN = 255
+RLE_MAX_COLORS = 256
+
+BYTES_PER_LINE = 32
+
+DATA_RE = re.compile(r"uint8_t\s+(\w+)_data\[\]\s*=\s*\{(.*?)\};", re.S)
+HEX_RE = re.compile(r"0x([0-9A-Fa-f]{2})")
+
+
+def parse_image(text):
+    m = DATA_RE.search(text)
+    if not m:
+        return None
+    name = m.group(1)
+    width = int(re.search(r"\.header\.w\s*=\s*(\d+)", text).group(1))
+    height = int(re.search(r"\.header\.h\s*=\s*(\d+)", text).group(1))
+    cf = re.search(r"\.header\.cf\s*=\s*(\w+)", text).group(1)
+    data = bytes(int(b, 16) for b in HEX_RE.findall(m.group(2)))
+    header = text[:text.index("#include")]
+    source = re.search(r"// IMAGE DATA: (.*)", text)
+    return {
+        "name": name,
+        "w": width,
+        "h": height,
+        "cf": cf,
+        "data": data,
+        "header": header,
+        "source": source.group(1) if source else name,
+    }
+
+
+def blend(pixel, alpha, background):
+    """Blend one RGB565 pixel onto an RGB565 background, all channels in 565 units."""
+    out = 0
+    for shift, mask in ((11, 0x1F), (5, 0x3F), (0, 0x1F)):
+        fg = (pixel >> shift) & mask
+        bg = (background >> shift) & mask
+        out |= ((fg * alpha + bg * (255 - alpha) + 127) // 255) << shift
+    return out
+
+
+def to_rgb565(rgb888):
+    r = (rgb888 >> 16) & 0xFF
+    g = (rgb888 >> 8) & 0xFF
+    b = rgb888 & 0xFF
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def preblend(img, background):
+    """Return the image as rows of RGB565 values (LV_COLOR_16_SWAP byte order is
+    handled when the bytes are emitted)."""
+    bg = to_rgb565(background)
+    data = img["data"]
+    rows = []
+    for y in range(img["h"]):
+        row = []
+        for x in range(img["w"]):
+            i = (y * img["w"] + x) * 3
+            # LV_COLOR_16_SWAP: high byte first, then the alpha byte
+            pixel = (data[i] << 8) | data[i + 1]
+            row.append(blend(pixel, data[i + 2], bg))
+        rows.append(row)
+    return rows
+
+
+def color_bytes(c):
+    # Same in-memory layout as lv_color_t with LV_COLOR_16_SWAP=1
+    return bytes(((c >> 8) & 0xFF, c & 0xFF))
+
+
+def encode_rgb565(rows):
+    return b"".join(color_bytes(c) for row in rows for c in row)
+
+
+def encode_rle(rows):
+    """Layout (little endian), see img_rle.h:
+         u16 palette size, u16 reserved
+         palette as lv_color_t
+         u32 offset of every row, relative to the first run
+         (u8 count, u8 palette index) runs, rows never share a run
+    """
+    palette = []
+    index = {}
+    for row in rows:
+        for c in row:
+            if c not in index:
+                if len(palette) == RLE_MAX_COLORS:
+                    return None
+                index[c] = len(palette)
+                palette.append(c)
+
+    runs = bytearray()
+    offsets = []
+    for row in rows:
+        offsets.append(len(runs))
+        x = 0
+        while x < len(row):
+            n = 1
+            while x + n < len(row) and n < RLE_MAX_RUN and row[x + n] == row[x]:
+                n += 1
+            runs += bytes((n, index[row[x]]))
+            x += n
+
+    out = bytearray()
+    out += len(palette).to_bytes(2, "little") + bytes(2)
+    for c in palette:
+        out += color_bytes(c)
+    for off in offsets:
+        out += off.to_bytes(4, "little")
+    out += runs
+    return bytes(out)
+
+
+def emit(img, payload, cf, fmt, background):
+    lines = []
+    for i in range(0, len(payload), BYTES_PER_LINE):
+        chunk = payload[i:i + BYTES_PER_LINE]
+        lines.append("    " + ",".join("0x%02X" % b for b in chunk) + ",")
+    name = img["name"]
+    return (
+        img["header"] +
+        '#include "../ui.h"\n'
+        "\n"
+        "#ifndef LV_ATTRIBUTE_MEM_ALIGN\n"
+        "    #define LV_ATTRIBUTE_MEM_ALIGN\n"
+        "#endif\n"
+        "\n"
+        "// IMAGE DATA: %s\n"
+        "// Packed by tools/img_pack.py: %s, pre-blended on 0x%06X\n"
+        "const LV_ATTRIBUTE_MEM_ALIGN uint8_t %s_data[] = {\n"
+        "%s\n"
+        "};\n"
+        "const lv_img_dsc_t %s = {\n"
+        "    .header.always_zero = 0,\n"
+        "    .header.w = %d,\n"
+        "    .header.h = %d,\n"
+        "    .data_size = sizeof(%s_data),\n"
+        "    .header.cf = %s,\n"
+        "    .data = %s_data\n"
+        "};\n"
+    ) % (img["source"], fmt, background, name, "\n".join(lines), name,
+         img["w"], img["h"], name, cf, name)
+
+
+def pack_file(path, background, dry_run):
+    with open(path) as f:
+        img = parse_image(f.read())
+    if img is None:
+        print("%-32s not an image, skipped" % os.path.basename(path))
+        return None
+    if img["cf"] != "LV_IMG_CF_TRUE_COLOR_ALPHA":
+        print("%-32s already %s, skipped" % (img["name"], img["cf"]))
+        return None
+    if len(img["data"]) != img["w"] * img["h"] * 3:
+        sys.exit("%s: unexpected data size %d" % (path, len(img["data"])))
+
+    rows = preblend(img, background)
+    payload = encode_rgb565(rows)
+    cf, fmt = "LV_IMG_CF_TRUE_COLOR", "RGB565"
+    if img["name"] in RLE_ASSETS:
+        rle = encode_rle(rows)
+        if rle is not None and len(rle) < len(payload):
+            payload = rle
+            cf, fmt = "LV_IMG_CF_USER_ENCODED_0", "RLE"
+
+    before = len(img["data"])
+    print("%-32s %3dx%-3d %-6s %7d -> %7d bytes (%5.1f%%)" %
+          (img["name"], img["w"], img["h"], fmt, before, len(payload), 100.0 * len(payload) / before))
+
+    if not dry_run:
+        with open(path, "w") as f:
+            f.write(emit(img, payload, cf, fmt, background))
+    return before, len(payload)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("paths", nargs="+", help="image .c files or directories holding them")
+    parser.add_argument("--background", type=lambda v: int(v, 16), default=DEFAULT_BACKGROUND,
+                        help="background colour as RGB888 hex (default %06X)" % DEFAULT_BACKGROUND)
+    parser.add_argument("-n", "--dry-run", action="store_true", help="only print the size report")
+    args = parser.parse_args()
+
+    files = []
+    for p in args.paths:
+        if os.path.isdir(p):
+            files += sorted(os.path.join(p, f) for f in os.listdir(p) if f.endswith(".c"))
+        else:
+            files.append(p)
+
+    total_before = total_after = 0
+    for path in files:
+        sizes = pack_file(path, args.background, args.dry_run)
+        if sizes:
+            total_before += sizes[0]
+            total_after += sizes[1]
+
+    if total_before:
+        print("total %d -> %d bytes of flash, %d saved" % (total_before, total_after, total_before - total_after))
+
+
+if __name__ == "__main__":
+    main()
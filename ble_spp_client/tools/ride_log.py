@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+"""Decode the ride log written by main/ride_log.c.
+
+Input is either a dump of the `ridelog` partition,
+    parttool.py read_partition --partition-name ridelog --output ridelog.bin
+or a capture of UART0 after sending `ridelog`, where every page is one line
+of hex after "RLOG " (other log lines in the capture are skipped).
+
+Page layout (little endian), see main/ride_log_page.h:
+    header   u32 magic, u16 version, u16 payload length, u32 seq,
+             u32 session, u32 t0 ms, u16 records,
+             u8 motor pulley, u8 wheel pulley, u8 wheel diameter mm,
+             u8 motor poles, u16 reserved, u32 crc32 of the payload
+    payload  records, each a varint of the time since the previous record in
+             10 ms units, then for every field a zigzag varint of its change
+             since the previous record. Both start from 0 on every page.
+
+Fields: throttle (0-255), erpm, voltage dV, motor current dA, input current
+dA, amp hours cAh, link quality %.
+
+Pages that fail their CRC (e.g. overwritten during an export) are dropped.
+The records are written as CSV, one line per record, and a summary of every
+session (one boot of the remote) is printed:
+    python tools/ride_log.py ridelog.bin --csv ride.csv
+"""
+
+import argparse
+import csv
+import math
+import re
+import struct
+import sys
+import zlib
+
+# Must match ride_log_page.h, sim/tests/test_ride_log.c checks the round trip
+MAGIC = 0x474F4C52  # "RLOG"
+VERSION = 1
+PAGE_SIZE = 4096
+TIME_UNIT_MS = 10
+HEADER_FMT = "<IHHIIIHBBBBHI"
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+FIELDS = ("throttle", "erpm", "voltage_dv", "current_motor_da", "current_in_da", "amp_hours_cah", "link")
+EXPORT_RE = re.compile(r"RLOG ([0-9a-fA-F]+)\s*$")
+
+assert HEADER_SIZE == 32
+
+
+class Page:
+    def __init__(self, data):
+        (magic, version, self.payload_len, self.seq, self.session, self.t0_ms, self.records,
+         self.motor_pulley, self.wheel_pulley, self.wheel_diameter_mm, self.motor_poles,
+         _, self.crc) = struct.unpack_from(HEADER_FMT, data)
+        self.valid = (magic == MAGIC and version == VERSION and
+                      HEADER_SIZE + self.payload_len <= min(len(data), PAGE_SIZE))
+        if self.valid:
+            self.payload = data[HEADER_SIZE:HEADER_SIZE + self.payload_len]
+            self.valid = zlib.crc32(self.payload) == self.crc
+
+    def speed_kmh(self, erpm):
+        """Same gearing as vesc_config.c, eRPM is counted per pole pair."""
+        pole_pairs = self.motor_poles // 2
+        if not pole_pairs or self.motor_poles % 2 or not self.wheel_pulley:
+            return 0.0
+        wheel_turns = self.motor_pulley / (pole_pairs * self.wheel_pulley)
+        circumference_m = self.wheel_diameter_mm / 1000.0 * math.pi
+        return erpm * wheel_turns * circumference_m * 60.0 / 1000.0
+
+    def decode(self):
+        """Yield (ms since boot, values) for every record."""
+        pos = 0
+        t_ms = self.t0_ms
+        values = [0] * len(FIELDS)
+        for _ in range(self.records):
+            units, pos = read_varint(self.payload, pos)
+            t_ms += units * TIME_UNIT_MS
+            for i in range(len(FIELDS)):
+                delta, pos = read_varint(self.payload, pos)
+                values[i] += (delta >> 1) ^ -(delta & 1)
+            yield t_ms, list(values)
+
+
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        if pos >= len(data):
+            raise ValueError("record runs past the payload")
+        b = data[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        if not b & 0x80:
+            return value, pos
+        shift += 7
+
+
+def read_pages(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    blobs = []
+    if data.startswith(struct.pack("<I", MAGIC)) or b"RLOG " not in data:
+        blobs = [data[i:i + PAGE_SIZE] for i in range(0, len(data) - HEADER_SIZE + 1, PAGE_SIZE)]
+    else:
+        for line in data.decode("ascii", "replace").splitlines():
+            m = EXPORT_RE.search(line)
+            if m and len(m.group(1)) % 2 == 0:
+                blobs.append(bytes.fromhex(m.group(1)))
+
+    pages = []
+    dropped = 0
+    for blob in blobs:
+        if len(blob) < HEADER_SIZE:
+            continue
+        page = Page(blob)
+        if page.valid:
+            pages.append(page)
+        elif struct.unpack_from("<I", blob)[0] == MAGIC:
+            dropped += 1
+    if dropped:
+        print("%d page(s) failed their CRC and were dropped" % dropped, file=sys.stderr)
+    # seq wraps after 2^32 pages, a log never gets near that
+    pages.sort(key=lambda p: p.seq)
+    return pages
+
+
+class Session:
+    def __init__(self, number):
+        self.number = number
+        self.start_ms = None
+        self.last_ms = None
+        self.ridden_ms = 0
+        self.distance_km = 0.0
+        self.max_speed = 0.0
+        self.min_voltage = None
+        self.max_voltage = None
+        self.max_current_motor = 0.0
+        self.max_current_in = 0.0
+        self.first_ah = None
+        self.last_ah = None
+        self.link_sum = 0
+        self.samples = 0
+
+    def add(self, t_ms, values, speed):
+        if self.start_ms is None:
+            self.start_ms = t_ms
+        elif t_ms > self.last_ms:
+            # Gaps are disconnects, they do not count as riding
+            dt = t_ms - self.last_ms
+            if dt <= 10 * 1000:
+                self.ridden_ms += dt
+                self.distance_km += abs(speed) * dt / 3600000.0
+        self.last_ms = t_ms
+
+        voltage = values[2] / 10.0
+        self.max_speed = max(self.max_speed, abs(speed))
+        self.min_voltage = voltage if self.min_voltage is None else min(self.min_voltage, voltage)
+        self.max_voltage = voltage if self.max_voltage is None else max(self.max_voltage, voltage)
+        self.max_current_motor = max(self.max_current_motor, abs(values[3]) / 10.0)
+        self.max_current_in = max(self.max_current_in, values[4] / 10.0)
+        ah = values[5] / 100.0
+        if self.first_ah is None:
+            self.first_ah = ah
+        self.last_ah = ah
+        self.link_sum += values[6]
+        self.samples += 1
+
+    def summary(self):
+        return ("session %d: %d records, %.1f min ridden, %.2f km, max %.1f km/h, "
+                "%.1f-%.1f V (sag %.1f V), max %.1f A motor / %.1f A battery, "
+                "%.2f Ah used, link %d %%") % (
+            self.number, self.samples, self.ridden_ms / 60000.0, self.distance_km, self.max_speed,
+            self.min_voltage, self.max_voltage, self.max_voltage - self.min_voltage,
+            self.max_current_motor, self.max_current_in, self.last_ah - self.first_ah,
+            self.link_sum // self.samples)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("input", help="partition dump or UART capture")
+    parser.add_argument("--csv", help="write every record to this file")
+    args = parser.parse_args()
+
+    pages = read_pages(args.input)
+    if not pages:
+        sys.exit("%s: no ride log pages" % args.input)
+
+    out = None
+    writer = None
+    if args.csv:
+        out = open(args.csv, "w", newline="")
+        writer = csv.writer(out)
+        writer.writerow(("session", "t_ms", "speed_kmh") + FIELDS)
+
+    sessions = {}
+    for page in pages:
+        session = sessions.setdefault(page.session, Session(page.session))
+        try:
+            for t_ms, values in page.decode():
+                speed = page.speed_kmh(values[1])
+                session.add(t_ms, values, speed)
+                if writer:
+                    writer.writerow([page.session, t_ms, "%.2f" % speed] + values)
+        except ValueError as e:
+            print("page %d: %s" % (page.seq, e), file=sys.stderr)
+
+    if out:
+        out.close()
+    for number in sorted(sessions):
+        if sessions[number].samples:
+            print(sessions[number].summary())
+
+
+if __name__ == "__main__":
+    main()